@@ -0,0 +1,75 @@
+#ifndef BOTGAME_H
+#define BOTGAME_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include "GameSession.h"
+#include "GameClock.h"
+#include "GameTuning.h"
+#include "TypistBot.h"
+#include "Histogram.h"
+
+// 봇 한 판의 결과
+struct BotGameResult
+{
+    int score;
+    int snowmen;
+    int keys;
+    int ticks;
+    int netWpm;          // 맞게 친 글자 기준 WPM (TypingAnalytics)
+    int accuracyPercent; // 맞게 친 글자 / 친 글자
+    int wordLatencyP50;  // 단어가 생긴 뒤 맞힐 때까지 (ms, 중앙값)
+};
+
+// 봇 하나로 헤드리스 게임 한 판을 끝까지 진행 (bot_harness, level_tuner 공용)
+// 현재 스레드를 가상 시계로 바꿔서 진행하고, tickNanos 가 있으면 tick 비용을 기록한다.
+// 세션 난수와 봇 난수는 seed 에서 나눠 뽑으므로 같은 seed 면 같은 게임이 나온다.
+inline BotGameResult runBotGame(int level, const GameTuning &tuning, const TypistBot::Profile &profile,
+                                uint32_t seed, int tickMillis, Histogram *tickNanos = nullptr)
+{
+    // 실제 시각 근처에서 시작해야 time_t 계산이 자연스러움
+    GameClock::useSimulated(1700000000000LL);
+
+    std::seed_seq sequence{seed};
+    uint32_t seeds[2];
+    sequence.generate(seeds, seeds + 2);
+    GameSession session(level, tuning, 60, 50, seeds[0]);
+    TypistBot bot(profile, seeds[1]);
+    BotGameResult result = {0, 0, 0, 0, 0, 0, 0};
+
+    while (!session.isFinished())
+    {
+        bot.update(session, GameClock::nowMillis());
+
+        if (tickNanos)
+        {
+            auto tickStart = std::chrono::steady_clock::now();
+            session.tick();
+            auto tickEnd = std::chrono::steady_clock::now();
+            tickNanos->record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - tickStart).count()));
+        }
+        else
+        {
+            session.tick();
+        }
+        result.ticks++;
+
+        GameClock::advance(tickMillis);
+    }
+
+    session.end();
+    result.score = session.getGameManager()->getTotalScore();
+    result.snowmen = session.getGameManager()->getCollectedSnowmen();
+    result.keys = bot.getKeysSent();
+    TypingAnalytics &analytics = session.getAnalytics();
+    result.netWpm = static_cast<int>(llround(analytics.getSessionWpm(GameClock::nowMillis())));
+    result.accuracyPercent = static_cast<int>(llround(analytics.getAccuracy() * 100.0));
+    result.wordLatencyP50 = static_cast<int>(analytics.getWordLatencyMillis().percentile(50));
+
+    GameClock::useReal();
+    return result;
+}
+
+#endif // BOTGAME_H
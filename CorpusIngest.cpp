@@ -0,0 +1,440 @@
+#include "CorpusIngest.h"
+#include "Dictionary.h"
+#include "Tokenizer.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+#include <string_view>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace
+{
+    const int SHARD_COUNT = 64;
+
+    // 처리 단위: 한 파일의 [begin, end) 구간
+    struct Chunk
+    {
+        const char *begin;
+        const char *end;
+    };
+
+    struct Candidate
+    {
+        uint64_t hash;
+        std::string text;
+        double score;
+    };
+
+    // 스레드별 결과 (해시 상위 비트로 샤드를 나눠 병합도 병렬로)
+    struct WorkerResult
+    {
+        std::vector<Candidate> candidates[SHARD_COUNT];
+        std::unordered_map<std::string, uint64_t> frequency[SHARD_COUNT];
+        uint64_t sentences = 0;
+        uint64_t candidateCount = 0;
+        uint64_t words = 0;
+    };
+
+    struct MappedFile
+    {
+        const char *data = nullptr;
+        size_t size = 0;
+    };
+
+    inline bool isTerminator(char c)
+    {
+        return c == '.' || c == '!' || c == '?';
+    }
+
+    // Dictionary::splitSentenceIntoWords 가 지우는 문자
+    inline bool isStripped(char c)
+    {
+        return c == '.' || c == ',' || c == '!' || c == '?';
+    }
+
+    inline char fold(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // 대소문자 무시 비교 (음수/0/양수)
+    int compareFolded(const std::string &a, const std::string &b)
+    {
+        size_t length = std::min(a.size(), b.size());
+        for (size_t i = 0; i < length; i++)
+        {
+            unsigned char x = static_cast<unsigned char>(fold(a[i]));
+            unsigned char y = static_cast<unsigned char>(fold(b[i]));
+            if (x != y)
+            {
+                return x < y ? -1 : 1;
+            }
+        }
+        return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+    }
+
+    // 빈 줄: 줄바꿈 바로 뒤에 (\r 을 건너뛰고) 또 줄바꿈 (\n\n, \r\n\r\n)
+    inline bool isBlankLine(const char *p, const char *end)
+    {
+        if (*p != '\n')
+        {
+            return false;
+        }
+        const char *next = p + 1;
+        while (next < end && *next == '\r')
+        {
+            next++;
+        }
+        return next < end && *next == '\n';
+    }
+
+    inline uint64_t shardOf(uint64_t hash)
+    {
+        return hash >> 58; // 상위 6비트 -> 64 샤드
+    }
+
+    uint64_t hashFolded(const std::string &text)
+    {
+        uint64_t hash = 1469598103934665603ull;
+        for (char c : text)
+        {
+            hash ^= static_cast<unsigned char>(fold(c));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // pos 이후 첫 문장 끝 바로 다음 위치 (구간 경계는 항상 문장 끝에 맞춤)
+    const char *nextBoundary(const char *pos, const char *end)
+    {
+        while (pos < end && !isTerminator(*pos))
+        {
+            pos++;
+        }
+        return pos < end ? pos + 1 : end;
+    }
+
+    // 단어 하나 검사 (구두점 제거 후 영문자와 내부 '/- 만 허용)
+    bool isTypeableWord(std::string_view word, int maxLength)
+    {
+        if (word.empty() || static_cast<int>(word.size()) > maxLength)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < word.size(); i++)
+        {
+            char c = word[i];
+            bool letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            bool joiner = (c == '\'' || c == '-') && i > 0 && i + 1 < word.size();
+            if (!letter && !joiner)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    class SentenceScanner
+    {
+    private:
+        const CorpusIngest::Options &options;
+        WorkerResult &result;
+        // 재사용 버퍼 (단어마다 새 문자열을 만들지 않도록)
+        TokenTable tokens;
+        std::string key;
+
+    public:
+        SentenceScanner(const CorpusIngest::Options &opts, WorkerResult &out) : options(opts), result(out) {}
+
+        void scan(const Chunk &chunk)
+        {
+            const char *sentenceStart = chunk.begin;
+            for (const char *p = chunk.begin; p < chunk.end; p++)
+            {
+                if (isTerminator(*p) || isBlankLine(p, chunk.end))
+                {
+                    processSentence(sentenceStart, p + 1);
+                    sentenceStart = p + 1;
+                }
+            }
+            if (sentenceStart < chunk.end)
+            {
+                processSentence(sentenceStart, chunk.end);
+            }
+        }
+
+    private:
+        void processSentence(const char *begin, const char *end)
+        {
+            // 공백 기준 분리 + 구두점 제거 (구두점만 있던 단어는 getDroppedCount 로만 남음, 그런 문장은 후보가 아님)
+            std::string_view source(begin, static_cast<size_t>(end - begin));
+            tokens.clear();
+            tokens.tokenize(source);
+            if (tokens.empty() && tokens.getDroppedCount() == 0)
+            {
+                return;
+            }
+            result.sentences++;
+
+            bool valid = tokens.getDroppedCount() == 0 &&
+                         static_cast<int>(tokens.size()) == Dictionary::WORDS_PER_SENTENCE;
+            for (size_t i = 0; i < tokens.size(); i++)
+            {
+                std::string_view word = tokens[i];
+                key.assign(word.data(), word.size());
+                std::transform(key.begin(), key.end(), key.begin(), fold);
+
+                if (!isTypeableWord(word, options.maxWordLength))
+                {
+                    valid = false;
+                    continue;
+                }
+
+                // 빈도는 후보 여부와 상관없이 코퍼스 전체에서 셈
+                result.frequency[shardOf(hashFolded(key))][key]++;
+                result.words++;
+            }
+
+            if (!valid)
+            {
+                return;
+            }
+
+            // 공백을 정리한 원문 (쉼표 등은 화면 표시용으로 유지)
+            std::string text;
+            text.reserve(static_cast<size_t>(end - begin));
+            for (size_t i = 0; i < tokens.size(); i++)
+            {
+                if (i > 0)
+                {
+                    text += ' ';
+                }
+                std::string_view raw = tokens.getSource(source, i);
+                text.append(raw.data(), raw.size());
+            }
+            while (!text.empty() && isStripped(text.back()))
+            {
+                text.pop_back();
+            }
+
+            uint64_t hash = hashFolded(text);
+            result.candidates[shardOf(hash)].push_back(Candidate{hash, std::move(text), 0.0});
+            result.candidateCount++;
+        }
+    };
+
+    bool mapFile(const std::string &path, MappedFile &file)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            return false;
+        }
+        file.size = static_cast<size_t>(st.st_size);
+        if (file.size == 0)
+        {
+            close(fd);
+            file.data = nullptr;
+            return true;
+        }
+        void *mapped = mmap(nullptr, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            return false;
+        }
+        madvise(mapped, file.size, MADV_SEQUENTIAL);
+        file.data = static_cast<const char *>(mapped);
+        return true;
+    }
+
+    // 0..count-1 작업을 스레드들이 원자적 카운터로 나눠 가져감
+    template <typename Fn>
+    void parallelFor(int threadCount, size_t count, Fn fn)
+    {
+        std::atomic<size_t> nextIndex(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                for (size_t i = nextIndex++; i < count; i = nextIndex++)
+                {
+                    fn(t, i);
+                } });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+bool CorpusIngest::run(const std::vector<std::string> &paths, std::string &error)
+{
+    stats = Stats();
+    levelSentences.clear();
+
+    int threadCount = options.threadCount > 0 ? options.threadCount
+                                              : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // 1. 파일 매핑 및 구간 분할
+    std::vector<MappedFile> files;
+    std::vector<Chunk> chunks;
+    for (const std::string &path : paths)
+    {
+        MappedFile file;
+        if (!mapFile(path, file))
+        {
+            error = "cannot read " + path;
+            for (auto &f : files)
+            {
+                munmap(const_cast<char *>(f.data), f.size);
+            }
+            return false;
+        }
+        if (!file.data)
+        {
+            continue;
+        }
+        files.push_back(file);
+        stats.bytes += file.size;
+
+        size_t chunkSize = std::max<size_t>(1 << 20, file.size / (static_cast<size_t>(threadCount) * 4));
+        const char *end = file.data + file.size;
+        const char *begin = file.data;
+        while (begin < end)
+        {
+            const char *nominal = begin + std::min(chunkSize, static_cast<size_t>(end - begin));
+            const char *chunkEnd = nominal < end ? nextBoundary(nominal, end) : end;
+            chunks.push_back(Chunk{begin, chunkEnd});
+            begin = chunkEnd;
+        }
+    }
+
+    // 2. 문장 분리 + 후보 수집 + 단어 빈도 (스레드별)
+    std::vector<WorkerResult> results(static_cast<size_t>(threadCount));
+    {
+        std::vector<SentenceScanner> scanners;
+        for (int t = 0; t < threadCount; t++)
+        {
+            scanners.emplace_back(options, results[static_cast<size_t>(t)]);
+        }
+        parallelFor(threadCount, chunks.size(), [&](int t, size_t i)
+                    { scanners[static_cast<size_t>(t)].scan(chunks[i]); });
+    }
+
+    for (auto &file : files)
+    {
+        munmap(const_cast<char *>(file.data), file.size);
+    }
+
+    for (const auto &result : results)
+    {
+        stats.sentences += result.sentences;
+        stats.candidates += result.candidateCount;
+        stats.words += result.words;
+    }
+
+    // 3. 샤드별 병렬 병합: 단어 빈도 합치기 + 후보 중복 제거
+    std::vector<std::unordered_map<std::string, uint64_t>> frequency(SHARD_COUNT);
+    std::vector<std::vector<Candidate>> unique(SHARD_COUNT);
+    parallelFor(threadCount, SHARD_COUNT, [&](int, size_t shard)
+                {
+        auto &merged = frequency[shard];
+        auto &list = unique[shard];
+        for (auto &result : results)
+        {
+            for (auto &entry : result.frequency[shard])
+            {
+                merged[entry.first] += entry.second;
+            }
+            result.frequency[shard].clear();
+
+            auto &source = result.candidates[shard];
+            list.insert(list.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+            source.clear();
+        }
+
+        // 해시, 대소문자 무시 글자, 원문 순으로 정렬해 같은 문장끼리 붙여 둠
+        // (해시가 충돌한 다른 문장은 글자가 달라 남고, 같은 문장 중에는 원문이 가장 앞인 것이 남음)
+        std::sort(list.begin(), list.end(), [](const Candidate &a, const Candidate &b)
+                  {
+            if (a.hash != b.hash)
+            {
+                return a.hash < b.hash;
+            }
+            int folded = compareFolded(a.text, b.text);
+            return folded != 0 ? folded < 0 : a.text < b.text; });
+        list.erase(std::unique(list.begin(), list.end(), [](const Candidate &a, const Candidate &b)
+                               { return a.hash == b.hash && compareFolded(a.text, b.text) == 0; }),
+                   list.end()); });
+
+    for (int shard = 0; shard < SHARD_COUNT; shard++)
+    {
+        stats.vocabulary += frequency[static_cast<size_t>(shard)].size();
+        stats.unique += unique[static_cast<size_t>(shard)].size();
+    }
+    if (stats.unique == 0)
+    {
+        error = "no usable sentences found";
+        return false;
+    }
+
+    // 4. 난이도 점수 (평균 단어 길이 + 평균 희귀도)
+    double totalWords = static_cast<double>(std::max<uint64_t>(1, stats.words));
+    parallelFor(threadCount, SHARD_COUNT, [&](int, size_t shard)
+                {
+        TokenTable words;
+        std::string word;
+        for (Candidate &candidate : unique[shard])
+        {
+            words.clear();
+            words.tokenize(candidate.text);
+            double length = 0.0;
+            double rarity = 0.0;
+            for (size_t i = 0; i < words.size(); i++)
+            {
+                word.assign(words[i]);
+                length += static_cast<double>(word.size());
+                std::transform(word.begin(), word.end(), word.begin(), fold);
+                const auto &table = frequency[shardOf(hashFolded(word))];
+                auto it = table.find(word);
+                double count = it != table.end() ? static_cast<double>(it->second) : 1.0;
+                rarity += -std::log2(count / totalWords);
+            }
+            double n = static_cast<double>(std::max<size_t>(1, words.size()));
+            candidate.score = options.lengthWeight * (length / n) + options.rarityWeight * (rarity / n);
+        } });
+
+    // 5. 점수 순으로 정렬해 레벨을 같은 크기로 나눔
+    std::vector<Candidate> all;
+    all.reserve(stats.unique);
+    for (auto &list : unique)
+    {
+        all.insert(all.end(), std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
+        std::vector<Candidate>().swap(list);
+    }
+    std::sort(all.begin(), all.end(), [](const Candidate &a, const Candidate &b)
+              { return a.score != b.score ? a.score < b.score : a.hash < b.hash; });
+
+    // 게임이 고를 수 없는 레벨은 만들지 않음
+    int levelCount = std::max(1, std::min(options.levelCount, static_cast<int>(Dictionary::LEVEL_COUNT)));
+    for (size_t i = 0; i < all.size(); i++)
+    {
+        int level = 1 + static_cast<int>(i * static_cast<size_t>(levelCount) / all.size());
+        levelSentences[level].push_back(std::move(all[i].text));
+    }
+    return true;
+}
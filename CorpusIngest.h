@@ -0,0 +1,60 @@
+#ifndef CORPUSINGEST_H
+#define CORPUSINGEST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+// CorpusIngest: 큰 텍스트 덤프에서 게임용 문장을 뽑아 레벨까지 자동으로 나누는 파이프라인
+//
+// 1. 입력 파일을 mmap 하고 코어 수만큼 문장 경계에 맞춰 구간을 나눔
+// 2. 각 스레드가 구간을 문장으로 자르고, 모든 단어의 빈도를 세고,
+//    정확히 WORDS_PER_SENTENCE 단어인 문장만 후보로 남김
+// 3. 대소문자 무시 64비트 해시로 후보 중복 제거 (해시가 같으면 글자까지 비교), 단어 빈도는 샤드별로 병렬 병합
+// 4. 단어 길이와 희귀도(빈도의 -log2)로 난이도 점수를 매기고 점수 순으로 레벨 분할
+class CorpusIngest
+{
+public:
+    struct Options
+    {
+        int levelCount;      // 나눌 레벨 수 (쉬운 문장이 1레벨, 1..Dictionary::LEVEL_COUNT)
+        int threadCount;     // 0이면 hardware_concurrency
+        int maxWordLength;   // 입력칸에 들어가는 최대 단어 길이
+        double lengthWeight; // 난이도 점수: 평균 단어 길이 가중치
+        double rarityWeight; // 난이도 점수: 평균 희귀도 가중치
+
+        Options() : levelCount(3), threadCount(0), maxWordLength(20),
+                    lengthWeight(1.0), rarityWeight(0.5) {}
+    };
+
+    struct Stats
+    {
+        uint64_t bytes;
+        uint64_t sentences;  // 잘라낸 전체 문장 수
+        uint64_t candidates; // 단어 수가 맞는 후보 (중복 포함)
+        uint64_t unique;     // 중복 제거 후
+        uint64_t words;      // 전체 단어 수
+        uint64_t vocabulary; // 서로 다른 단어 수
+
+        Stats() : bytes(0), sentences(0), candidates(0), unique(0), words(0), vocabulary(0) {}
+    };
+
+private:
+    Options options;
+    Stats stats;
+
+    // 레벨별 결과 문장 (SnowDict::write 에 그대로 넘길 수 있는 형태)
+    std::map<int, std::vector<std::string>> levelSentences;
+
+public:
+    explicit CorpusIngest(const Options &opts = Options()) : options(opts) {}
+
+    // 입력 파일들을 처리 (실패 시 error 설정)
+    bool run(const std::vector<std::string> &paths, std::string &error);
+
+    const std::map<int, std::vector<std::string>> &getLevelSentences() const { return levelSentences; }
+    const Stats &getStats() const { return stats; }
+};
+
+#endif // CORPUSINGEST_H
@@ -1,25 +1,207 @@
 #include "Dictionary.h"
-#include <sstream>
+#include "Tokenizer.h"
 #include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <cstdlib>
+#include <sys/stat.h>
 
-Dictionary::Dictionary() : currentLevel(1), currentSentenceIndex(0)
+// ===== Corpus =====
+
+static std::atomic<uint64_t> corpusVersions{0};
+
+Corpus::Corpus() : fileDevice(0), fileInode(0), fileSize(-1), fileModifiedNanos(0),
+                   version(corpusVersions.fetch_add(1, std::memory_order_relaxed) + 1)
+{
+}
+
+std::shared_ptr<const Corpus> Corpus::createBuiltin()
+{
+    std::shared_ptr<Corpus> corpus(new Corpus());
+    corpus->initializeSentences();
+    return corpus;
+}
+
+std::shared_ptr<const Corpus> Corpus::load(const std::string &path, std::string &error)
+{
+    // 여는 파일과 같은 파일의 식별 정보를 쓰도록 열기 전에 stat (열고 나서 교체되면 다음 검사에서 다시 불러옴)
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+    {
+        error = "cannot stat " + path;
+        return nullptr;
+    }
+
+    std::shared_ptr<Corpus> corpus(new Corpus());
+    if (!corpus->compiled.open(path, error))
+    {
+        return nullptr;
+    }
+    corpus->sourcePath = path;
+    corpus->fileDevice = static_cast<uint64_t>(info.st_dev);
+    corpus->fileInode = static_cast<uint64_t>(info.st_ino);
+    corpus->fileSize = static_cast<int64_t>(info.st_size);
+    corpus->fileModifiedNanos = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec;
+    return corpus;
+}
+
+std::shared_ptr<const Corpus> Corpus::loadFromEnvironment()
+{
+    std::string error;
+    const char *path = getenv("SNOWMAN_DICT");
+    if (path && *path)
+    {
+        std::shared_ptr<const Corpus> corpus = load(path, error);
+        if (corpus)
+        {
+            return corpus;
+        }
+    }
+    return createBuiltin();
+}
+
+std::shared_ptr<const Corpus> &Corpus::publishedSlot()
+{
+    static std::shared_ptr<const Corpus> slot = loadFromEnvironment();
+    return slot;
+}
+
+std::shared_ptr<const Corpus> Corpus::current()
+{
+    return std::atomic_load_explicit(&publishedSlot(), std::memory_order_acquire);
+}
+
+void Corpus::publish(std::shared_ptr<const Corpus> corpus)
+{
+    if (corpus)
+    {
+        std::atomic_store_explicit(&publishedSlot(), std::move(corpus), std::memory_order_release);
+    }
+}
+
+bool Corpus::reloadIfChanged()
 {
-    initializeSentences();
-    initRandomSeed();
+    const char *path = getenv("SNOWMAN_DICT");
+    if (!path || !*path)
+    {
+        return false;
+    }
+
+    std::shared_ptr<const Corpus> old = current();
+    struct stat info;
+    if (stat(path, &info) != 0)
+    {
+        return false;
+    }
+    int64_t modified = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec;
+    if (old->sourcePath == path && old->fileDevice == static_cast<uint64_t>(info.st_dev) &&
+        old->fileInode == static_cast<uint64_t>(info.st_ino) && old->fileSize == static_cast<int64_t>(info.st_size) &&
+        old->fileModifiedNanos == modified)
+    {
+        return false;
+    }
+
+    std::string error;
+    std::shared_ptr<const Corpus> fresh = load(path, error);
+    if (!fresh)
+    {
+        return false;
+    }
+
+    // 그 사이 다른 스레드가 먼저 교체했으면 그 버전을 그대로 둠
+    return std::atomic_compare_exchange_strong_explicit(&publishedSlot(), &old, fresh,
+                                                        std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+int Corpus::getSentenceCount(int level) const
+{
+    if (compiled.isOpen())
+    {
+        return compiled.getSentenceCount(level);
+    }
+
+    auto it = levelSentences.find(level);
+    if (it != levelSentences.end()) {
+        return static_cast<int>(it->second.size());
+    }
+    return 0;
+}
+
+std::string_view Corpus::getSentence(int level, int sentenceIndex) const
+{
+    if (compiled.isOpen())
+    {
+        uint32_t sentenceId = compiled.getSentenceId(level, sentenceIndex);
+        if (sentenceId == UINT32_MAX)
+        {
+            return std::string_view();
+        }
+        return compiled.getText(sentenceId);
+    }
+
+    auto it = levelSentences.find(level);
+    if (it == levelSentences.end() || sentenceIndex < 0 || sentenceIndex >= static_cast<int>(it->second.size())) {
+        return std::string_view();
+    }
+    return it->second[sentenceIndex];
+}
+
+void Corpus::copyWords(int level, int sentenceIndex, std::vector<std::string> &words) const
+{
+    words.clear();
+
+    // 컴파일된 코퍼스: 토큰화 없이 문자열 풀에서 바로 단어를 가져옴
+    if (compiled.isOpen())
+    {
+        uint32_t sentenceId = compiled.getSentenceId(level, sentenceIndex);
+        if (sentenceId == UINT32_MAX)
+        {
+            return;
+        }
+        uint32_t wordCount = compiled.getWordCount(sentenceId);
+        for (uint32_t i = 0; i < wordCount; i++)
+        {
+            std::string_view word = compiled.getWord(sentenceId, i);
+            if (word.empty())
+            {
+                words.clear(); // 깨진 토큰: 문장이 없는 것처럼
+                return;
+            }
+            words.emplace_back(word);
+        }
+        return;
+    }
+
+    std::string_view sentence = getSentence(level, sentenceIndex);
+    TokenTable tokens;
+    tokens.tokenize(sentence);
+    for (size_t i = 0; i < tokens.size(); i++)
+    {
+        words.emplace_back(tokens[i]);
+    }
 }
 
-void Dictionary::initRandomSeed()
+int Corpus::getLevelCount() const
 {
-    static bool seeded = false;
-    if (!seeded) {
-        srand(static_cast<unsigned int>(time(nullptr)));
-        seeded = true;
+    if (compiled.isOpen())
+    {
+        return static_cast<int>(compiled.getLevelCount());
     }
+    return static_cast<int>(levelSentences.size());
 }
 
-void Dictionary::initializeSentences()
+int Corpus::getLevelAt(int i) const
+{
+    if (compiled.isOpen())
+    {
+        return compiled.getLevelAt(static_cast<uint32_t>(i));
+    }
+    auto it = levelSentences.begin();
+    std::advance(it, i);
+    return it->first;
+}
+
+void Corpus::initializeSentences()
 {
     // ===== Level 1: 쉬운 문장 (7개) =====
     // 짧고 일상적인 단어, 기본 문법 구조
@@ -57,40 +239,90 @@ void Dictionary::initializeSentences()
     };
 }
 
-int Dictionary::getSentenceCount(int level) const
+// ===== Dictionary =====
+
+Dictionary::Dictionary() : Dictionary(Corpus::current())
 {
-    auto it = levelSentences.find(level);
-    if (it != levelSentences.end()) {
-        return static_cast<int>(it->second.size());
+}
+
+Dictionary::Dictionary(const std::string &snowdictPath)
+    : ownRandom(randomSeed()), random(&ownRandom), currentLevel(1), currentSentenceIndex(0)
+{
+    std::string error;
+    corpus = Corpus::load(snowdictPath, error);
+    if (!corpus)
+    {
+        corpus = Corpus::createBuiltin();
     }
-    return 0;
+    resetSamplers();
+}
+
+Dictionary::Dictionary(std::shared_ptr<const Corpus> sharedCorpus)
+    : corpus(std::move(sharedCorpus)), ownRandom(randomSeed()), random(&ownRandom), currentLevel(1), currentSentenceIndex(0)
+{
+    if (!corpus)
+    {
+        corpus = Corpus::createBuiltin();
+    }
+    resetSamplers();
+}
+
+Dictionary::Dictionary(GameRandom &sessionRandom)
+    : corpus(Corpus::current()), random(&sessionRandom), currentLevel(1), currentSentenceIndex(0)
+{
+    if (!corpus)
+    {
+        corpus = Corpus::createBuiltin();
+    }
+    resetSamplers();
+}
+
+bool Dictionary::loadCompiled(const std::string &path, std::string &error)
+{
+    std::shared_ptr<const Corpus> loaded = Corpus::load(path, error);
+    if (!loaded)
+    {
+        return false;
+    }
+
+    corpus = std::move(loaded);
+    resetSamplers();
+    return true;
+}
+
+void Dictionary::resetSamplers()
+{
+    levelSamplers.clear();
+    for (int i = 0; i < corpus->getLevelCount(); i++)
+    {
+        int level = corpus->getLevelAt(i);
+        levelSamplers[level].reset(static_cast<uint32_t>(corpus->getSentenceCount(level)), *random);
+    }
+}
+
+int Dictionary::getSentenceCount(int level) const
+{
+    return corpus->getSentenceCount(level);
 }
 
 std::vector<std::string> Dictionary::splitSentenceIntoWords(const std::string& sentence)
 {
+    // 공백 기준으로 분리하고 구두점(. , ! ?) 제거 (TokenTable)
+    TokenTable tokens;
+    tokens.tokenize(sentence);
     std::vector<std::string> words;
-    std::istringstream iss(sentence);
-    std::string word;
-    
-    // 공백 기준으로 단어 분리
-    while (iss >> word) {
-        // 구두점 제거 (마침표, 쉼표 등)
-        word.erase(std::remove_if(word.begin(), word.end(), 
-            [](char c) { return c == '.' || c == ',' || c == '!' || c == '?'; }), 
-            word.end());
-        
-        if (!word.empty()) {
-            words.push_back(word);
-        }
+    words.reserve(tokens.size());
+    for (size_t i = 0; i < tokens.size(); i++)
+    {
+        words.emplace_back(tokens[i]);
     }
-    
     return words;
 }
 
 std::vector<std::string> Dictionary::getWordsForLevel(int level, int sentenceIndex)
 {
     // 레벨 검증
-    if (level < 1 || level > 3) {
+    if (level < 1 || level > LEVEL_COUNT) {
         level = 1; // 기본값
     }
     
@@ -104,46 +336,52 @@ std::vector<std::string> Dictionary::getWordsForLevel(int level, int sentenceInd
     currentLevel = level;
     currentSentenceIndex = sentenceIndex;
     
-    // 문장 가져오기
-    std::string sentence = levelSentences[level][sentenceIndex];
-    
-    // 단어로 분리
-    currentWords = splitSentenceIntoWords(sentence);
-    
+    corpus->copyWords(level, sentenceIndex, currentWords);
     return currentWords;
 }
 
 std::string Dictionary::getFullSentence(int level, int sentenceIndex) const
+{
+    return std::string(corpus->getSentence(level, sentenceIndex));
+}
+
+std::vector<std::string> Dictionary::getRandomSentenceWords(int level)
 {
     // 레벨 검증
-    auto it = levelSentences.find(level);
-    if (it == levelSentences.end()) {
-        return "";
+    if (level < 1 || level > LEVEL_COUNT) {
+        level = 1;
     }
     
-    // 인덱스 검증
-    const std::vector<std::string>& sentences = it->second;
-    if (sentenceIndex < 0 || sentenceIndex >= static_cast<int>(sentences.size())) {
-        return "";
+    int randomIndex = pickRandomSentence(level);
+    if (randomIndex < 0) {
+        return std::vector<std::string>();
     }
     
-    return sentences[sentenceIndex];
+    return getWordsForLevel(level, randomIndex);
 }
 
-std::vector<std::string> Dictionary::getRandomSentenceWords(int level)
+int Dictionary::pickRandomSentence(int level)
 {
-    // 레벨 검증
-    if (level < 1 || level > 3) {
-        level = 1;
+    if (getSentenceCount(level) == 0) {
+        return -1;
     }
     
+    // 중복 없는 순서로 다음 문장 선택
+    return static_cast<int>(levelSamplers[level].next(*random));
+}
+
+std::string_view Dictionary::selectSentence(int level, int sentenceIndex)
+{
+    // 레벨/인덱스 검증 (getWordsForLevel 과 같은 기본값)
+    if (level < 1 || level > LEVEL_COUNT) {
+        level = 1;
+    }
     int sentenceCount = getSentenceCount(level);
-    if (sentenceCount == 0) {
-        return std::vector<std::string>();
+    if (sentenceIndex < 0 || sentenceIndex >= sentenceCount) {
+        sentenceIndex = 0;
     }
     
-    // 랜덤 문장 선택
-    int randomIndex = rand() % sentenceCount;
-    
-    return getWordsForLevel(level, randomIndex);
-}
\ No newline at end of file
+    currentLevel = level;
+    currentSentenceIndex = sentenceIndex;
+    return corpus->getSentence(level, sentenceIndex);
+}
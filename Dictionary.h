@@ -2,14 +2,111 @@
 #define DICTIONARY_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <memory>
+#include <cstdint>
+#include "SentenceSampler.h"
+#include "SnowDict.h"
 
-class Dictionary
+// Corpus: 레벨별 문장 데이터 (내장 문장 또는 mmap 한 .snowdict)
+// 만든 뒤에는 바뀌지 않으므로 여러 세션/스레드가 shared_ptr 로 같이 읽는다.
+//
+// 프로세스 전체에서 쓰는 코퍼스는 current() 가 돌려주는 "지금 버전" 하나다.
+// - 세션은 시작할 때 current() 로 버전 하나를 잡고 끝날 때까지 그 버전만 읽음 (읽는 동안 잠금/원자 연산 없음)
+// - reloadIfChanged() / publish() 로 새 버전을 원자적으로 바꿔 끼우면 새 세션부터 새 버전을 쓰고,
+//   이전 버전은 그것을 잡고 있던 마지막 세션이 끝날 때 해제됨 (RCU 방식)
+class Corpus
 {
 private:
     // 레벨별 문장 저장 (key: 레벨, value: 문장 리스트)
     std::map<int, std::vector<std::string>> levelSentences;
+
+    // 컴파일된 .snowdict 코퍼스 (열려 있으면 levelSentences 대신 사용)
+    SnowDictView compiled;
+
+    // 불러온 파일 (내장 문장이면 빈 문자열) 과 그 파일의 식별 정보 (바뀌었는지 비교용)
+    std::string sourcePath;
+    uint64_t fileDevice;
+    uint64_t fileInode;
+    int64_t fileSize;
+    int64_t fileModifiedNanos;
+
+    // 만들어진 순서 번호 (1 부터)
+    uint64_t version;
+
+    Corpus();
+    Corpus(const Corpus &) = delete;
+    Corpus &operator=(const Corpus &) = delete;
+
+    // 지금 버전을 담는 칸 (처음 쓸 때 SNOWMAN_DICT 또는 내장 문장으로 채움)
+    static std::shared_ptr<const Corpus> &publishedSlot();
+
+    // 내장 문장 데이터 채우기
+    void initializeSentences();
+
+public:
+    // 내장 문장 코퍼스
+    static std::shared_ptr<const Corpus> createBuiltin();
+
+    // .snowdict 파일 코퍼스 (실패하면 nullptr, error 에 이유)
+    static std::shared_ptr<const Corpus> load(const std::string &path, std::string &error);
+
+    // SNOWMAN_DICT 환경 변수에 경로가 있으면 그 파일, 없거나 열 수 없으면 내장 문장
+    static std::shared_ptr<const Corpus> loadFromEnvironment();
+
+    // 프로세스 전체의 지금 버전
+    static std::shared_ptr<const Corpus> current();
+
+    // 지금 버전 교체 (이미 current() 로 잡은 세션은 계속 이전 버전을 씀)
+    static void publish(std::shared_ptr<const Corpus> corpus);
+
+    // SNOWMAN_DICT 파일이 지금 버전을 만든 뒤 바뀌었으면 다시 불러와 교체 (교체했으면 true)
+    // 새 파일을 열 수 없으면 지금 버전을 그대로 둔다. snowdict-compile 은 rename 으로 교체하므로
+    // 이전 버전이 mmap 한 파일은 마지막 세션이 끝날 때까지 그대로 남는다.
+    static bool reloadIfChanged();
+
+    int getSentenceCount(int level) const;
+
+    // 문장 원문 (범위 밖이면 빈 뷰, 코퍼스가 살아 있는 동안 유효)
+    std::string_view getSentence(int level, int sentenceIndex) const;
+
+    // 문장의 단어들을 words 에 채움
+    void copyWords(int level, int sentenceIndex, std::vector<std::string> &words) const;
+
+    // 문장이 있는 레벨 목록 (레벨 번호 오름차순)
+    int getLevelCount() const;
+    int getLevelAt(int i) const;
+
+    bool isCompiled() const { return compiled.isOpen(); }
+    const std::string &getSourcePath() const { return sourcePath; }
+    uint64_t getVersion() const { return version; }
+
+    // 내장 문장 목록 (snowdict-compile --builtin 용, 컴파일된 코퍼스면 비어 있음)
+    const std::map<int, std::vector<std::string>> &getLevelSentences() const { return levelSentences; }
+};
+
+// Dictionary: 게임 세션 하나가 코퍼스를 읽는 커서
+// 공유 코퍼스(Corpus) 한 버전을 잡고, 세션별 상태(중복 없는 샘플러, 현재 문장)만 따로 가진다.
+class Dictionary
+{
+public:
+    // 한 문장(눈사람 하나)을 이루는 단어 수
+    static const int WORDS_PER_SENTENCE = 8;
+    // 게임에서 고를 수 있는 레벨 1..LEVEL_COUNT (그 밖의 레벨은 1레벨로 바꿔 읽음)
+    static const int LEVEL_COUNT = 3;
+
+private:
+    // 이 세션이 읽는 코퍼스 버전
+    std::shared_ptr<const Corpus> corpus;
+
+    // 레벨별 중복 없는 문장 샘플러 (Dictionary 인스턴스 = 게임 세션 단위)
+    std::map<int, SentenceSampler> levelSamplers;
+
+    // 샘플러가 쓰는 난수 (세션 것을 받거나, 받지 않았으면 ownRandom)
+    GameRandom ownRandom;
+    GameRandom *random;
     
     // 현재 로드된 문장의 단어들
     std::vector<std::string> currentWords;
@@ -19,15 +116,24 @@ private:
     int currentSentenceIndex;
 
 public:
-    // 생성자
+    // 생성자 (프로세스 전체의 지금 코퍼스 버전을 사용, Corpus::current)
     Dictionary();
+
+    // 컴파일된 .snowdict 파일로 생성 (열기 실패 시 내장 문장 사용, 공유 코퍼스와 별개)
+    explicit Dictionary(const std::string &snowdictPath);
+
+    // 주어진 코퍼스 버전으로 생성
+    explicit Dictionary(std::shared_ptr<const Corpus> sharedCorpus);
+
+    // 지금 코퍼스 버전 + 게임 세션의 난수로 생성 (SentenceManager, 같은 시드면 같은 문장 순서)
+    explicit Dictionary(GameRandom &sessionRandom);
+
+    Dictionary(const Dictionary &) = delete;
+    Dictionary &operator=(const Dictionary &) = delete;
     
     // 소멸자
     ~Dictionary() {}
     
-    // 초기 문장 데이터 로드
-    void initializeSentences();
-    
     // 레벨별 문장 개수 반환
     int getSentenceCount(int level) const;
     
@@ -40,21 +146,37 @@ public:
     // 현재 로드된 단어들 반환
     const std::vector<std::string>& getCurrentWords() const { return currentWords; }
     
-    // 랜덤으로 레벨에 맞는 문장 선택
+    // 랜덤으로 레벨에 맞는 문장 선택 (레벨의 모든 문장이 한 번씩 나오기 전에는 반복 없음)
     std::vector<std::string> getRandomSentenceWords(int level);
+
+    // 다음 랜덤 문장 번호만 뽑음 (문장이 없으면 -1)
+    int pickRandomSentence(int level);
+
+    // 문장을 현재 문장으로 정하고 원문을 돌려줌 (복사 없음: 내장 문장이나 mmap 한 코퍼스를 가리킴)
+    std::string_view selectSentence(int level, int sentenceIndex);
     
     // 현재 레벨 반환
     int getCurrentLevel() const { return currentLevel; }
     
     // 현재 문장 인덱스 반환
     int getCurrentSentenceIndex() const { return currentSentenceIndex; }
+
+    // .snowdict 파일 로드 (성공 시 이 세션만 그 코퍼스로 바꿈)
+    bool loadCompiled(const std::string &path, std::string &error);
+    bool isCompiled() const { return corpus->isCompiled(); }
+
+    // 이 세션이 읽는 코퍼스
+    const std::shared_ptr<const Corpus> &getCorpus() const { return corpus; }
+
+    // 내장 문장 목록 (snowdict-compile --builtin 용)
+    const std::map<int, std::vector<std::string>> &getLevelSentences() const { return corpus->getLevelSentences(); }
+
+    // 문장을 단어로 분리하는 헬퍼 함수 (snowdict-compile 과 같은 규칙을 쓰도록 공개)
+    static std::vector<std::string> splitSentenceIntoWords(const std::string& sentence);
     
 private:
-    // 문장을 단어로 분리하는 헬퍼 함수
-    std::vector<std::string> splitSentenceIntoWords(const std::string& sentence);
-    
-    // 랜덤 시드 초기화
-    void initRandomSeed();
+    // 레벨별 샘플러를 현재 문장 개수에 맞게 초기화
+    void resetSamplers();
 };
 
 #endif // DICTIONARY_H
\ No newline at end of file
@@ -1,9 +1,6 @@
 #ifndef FALLINGOBJECT_H
 #define FALLINGOBJECT_H
 
-#include <cstdlib>
-#include <ctime>
-
 // 추상 클래스 - 떨어지는 모든 객체의 기본 클래스
 class FallingObject
 {
@@ -18,24 +15,12 @@ protected:
     int gameAreaHeight;    // 게임 영역 높이 (경계 체크용)
     bool hasReachedBottom; // 바닥에 도달했는지
 
-    // 랜덤 시드 초기화 헬퍼
-    static void initRandomSeed()
-    {
-        static bool seeded = false;
-        if (!seeded)
-        {
-            srand(static_cast<unsigned int>(time(nullptr)));
-            seeded = true;
-        }
-    }
-
 public:
     // 생성자
     FallingObject(int areaWidth, int areaHeight, double speed = 1.0)
         : gameAreaWidth(areaWidth), gameAreaHeight(areaHeight),
           fallSpeed(speed), isActive(true), hasReachedBottom(false)
     {
-        initRandomSeed();
         y = 3; // 헤더 아래부터 시작
         initialY = y;
     }
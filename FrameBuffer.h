@@ -0,0 +1,479 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "RenderTarget.h"
+
+// FrameBuffer: 메모리 안의 화면 (터미널 없이 그리기)
+// - 셀마다 글자, 색 쌍 번호, 속성(A_BOLD 등)을 저장
+// - attrOn/attrOff, 줄 끝에서 다음 줄로 넘어가기, 화면 밖 좌표 무시는 ncurses stdscr 와 같게 동작
+// - openWindow() 창은 같은 셀 배열의 일부에 바로 그림 (창마다 속성 따로, 줄 넘김은 창 폭 기준)
+// - diff() 로 두 프레임의 바뀐 셀을 구하고, toGolden()/fromGolden() 텍스트로 골든 프레임과 비교
+class FrameBuffer : public RenderTarget
+{
+public:
+    // 한 칸 (8바이트, 빈 틈이 없어 줄 단위 memcmp 로 비교 가능)
+    struct Cell
+    {
+        uint32_t attrs; // 색 쌍을 뺀 속성 비트
+        uint16_t pair;  // 색 쌍 번호
+        char glyph;
+        char reserved;
+
+        bool operator==(const Cell &other) const
+        {
+            return glyph == other.glyph && pair == other.pair && attrs == other.attrs;
+        }
+        bool operator!=(const Cell &other) const { return !(*this == other); }
+    };
+
+    struct CellChange
+    {
+        int y;
+        int x;
+        Cell before;
+        Cell after;
+    };
+
+private:
+    // 그리는 영역 하나 (화면 전체 또는 창)와 그 영역의 현재 속성
+    struct Area
+    {
+        int top;
+        int left;
+        int rows;
+        int cols;
+        uint32_t attrs;
+        uint16_t pair;
+    };
+
+    class Window;
+
+    int height;
+    int width;
+    std::vector<Cell> cells;
+    Area screen;
+
+    static Cell blank()
+    {
+        Cell cell = {0, 0, ' ', 0};
+        return cell;
+    }
+
+    Cell &cellIn(const Area &area, int y, int x)
+    {
+        return cells[static_cast<size_t>((area.top + y) * width + area.left + x)];
+    }
+
+    // 커서 위치에 한 글자 쓰고 다음 칸으로 (영역의 마지막 칸을 넘으면 false, waddch 의 ERR)
+    bool put(const Area &area, int &y, int &x, char glyph)
+    {
+        if (glyph == '\n')
+        {
+            // 줄의 나머지를 지우고 다음 줄로
+            clearRow(area, y, x);
+            x = 0;
+            return ++y < area.rows;
+        }
+        if (glyph == '\t')
+        {
+            int stop = (x / 8 + 1) * 8;
+            while (x < stop && x < area.cols)
+            {
+                if (!put(area, y, x, ' '))
+                    return false;
+                if (x == 0)
+                    break; // 줄이 바뀌면 탭 끝
+            }
+            return true;
+        }
+        if (static_cast<unsigned char>(glyph) < 32 || glyph == 127)
+        {
+            // 제어 문자는 ^X 두 칸
+            return put(area, y, x, '^') && put(area, y, x, glyph == 127 ? '?' : static_cast<char>(glyph + 64));
+        }
+
+        Cell &cell = cellIn(area, y, x);
+        cell.glyph = glyph;
+        cell.pair = area.pair;
+        cell.attrs = area.attrs;
+        if (++x >= area.cols)
+        {
+            x = 0;
+            if (++y >= area.rows)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void clearRow(const Area &area, int y, int x)
+    {
+        for (int col = x; col < area.cols; col++)
+        {
+            cellIn(area, y, col) = blank();
+        }
+    }
+
+    void clearArea(const Area &area)
+    {
+        for (int y = 0; y < area.rows; y++)
+        {
+            clearRow(area, y, 0);
+        }
+    }
+
+    // 색 쌍이 들어 있으면 기존 색 쌍을 바꾸고, 나머지 비트는 OR (ncurses wattr_on)
+    static void attrOnIn(Area &area, attr_t attrs)
+    {
+        if (PAIR_NUMBER(attrs) > 0)
+        {
+            area.pair = static_cast<uint16_t>(PAIR_NUMBER(attrs));
+        }
+        area.attrs |= static_cast<uint32_t>(attrs & ~A_COLOR);
+    }
+
+    // 색 쌍이 들어 있으면 색 쌍을 0 으로 (ncurses wattr_off)
+    static void attrOffIn(Area &area, attr_t attrs)
+    {
+        if (PAIR_NUMBER(attrs) > 0)
+        {
+            area.pair = 0;
+        }
+        area.attrs &= ~static_cast<uint32_t>(attrs & ~A_COLOR);
+    }
+
+    void vprintIn(const Area &area, int y, int x, const char *format, va_list args)
+    {
+        if (y < 0 || y >= area.rows || x < 0 || x >= area.cols)
+        {
+            return; // wmove 실패와 같음
+        }
+        char text[1024];
+        int length = vsnprintf(text, sizeof(text), format, args);
+        if (length < 0)
+        {
+            return;
+        }
+        if (length >= static_cast<int>(sizeof(text)))
+        {
+            length = static_cast<int>(sizeof(text)) - 1;
+        }
+        for (int i = 0; i < length; i++)
+        {
+            if (!put(area, y, x, text[i]))
+            {
+                break;
+            }
+        }
+    }
+
+    // mvwaddchnstr 와 같게: 영역 속성/커서와 상관없이 셀을 그대로, 줄 끝에서 자름
+    void putCellsIn(const Area &area, int y, int x, const chtype *source, int count)
+    {
+        if (y < 0 || y >= area.rows || x < 0 || x >= area.cols)
+        {
+            return;
+        }
+        count = std::min(count, area.cols - x);
+        for (int i = 0; i < count; i++)
+        {
+            Cell &cell = cellIn(area, y, x + i);
+            cell.glyph = static_cast<char>(source[i] & A_CHARTEXT);
+            cell.pair = static_cast<uint16_t>(PAIR_NUMBER(source[i]));
+            cell.attrs = static_cast<uint32_t>(source[i] & A_ATTRIBUTES & ~A_COLOR);
+        }
+    }
+
+    std::unique_ptr<RenderTarget> openIn(const Area &parent, int rows, int cols, int top, int left);
+
+    static char styleChar(const Cell &cell)
+    {
+        static const char NORMAL[] = "0123456789abcdef";
+        static const char BOLD[] = "ABCDEFGHIJKLMNOP";
+        return (cell.attrs & A_BOLD) ? BOLD[cell.pair & 15] : NORMAL[cell.pair & 15];
+    }
+
+public:
+    FrameBuffer(int rows, int cols)
+        : height(rows > 0 ? rows : 1), width(cols > 0 ? cols : 1),
+          cells(static_cast<size_t>(height) * static_cast<size_t>(width), blank())
+    {
+        screen = {0, 0, height, width, 0, 0};
+    }
+
+    int getHeight() const override { return height; }
+    int getWidth() const override { return width; }
+
+    void clear() override { std::fill(cells.begin(), cells.end(), blank()); }
+    void clearToEndOfLine(int y, int x) override
+    {
+        if (y >= 0 && y < height && x >= 0 && x < width)
+            clearRow(screen, y, x);
+    }
+    void attrOn(attr_t attrs) override { attrOnIn(screen, attrs); }
+    void attrOff(attr_t attrs) override { attrOffIn(screen, attrs); }
+    void vprint(int y, int x, const char *format, va_list args) override { vprintIn(screen, y, x, format, args); }
+    void putCells(int y, int x, const chtype *cells, int count) override { putCellsIn(screen, y, x, cells, count); }
+
+    // 메모리에 바로 그리므로 내보낼 것이 없음
+    void present() override {}
+    void stage() override {}
+    void flush() override {}
+
+    std::unique_ptr<RenderTarget> openWindow(int rows, int cols, int top, int left) override
+    {
+        return openIn(screen, rows, cols, top, left);
+    }
+
+    const Cell &at(int y, int x) const { return cells[static_cast<size_t>(y * width + x)]; }
+    const Cell *row(int y) const { return &cells[static_cast<size_t>(y * width)]; }
+
+    // (y, x) 부터 셀 count 개를 그대로 덮어씀 (줄 끝을 넘는 부분은 버림, 관전 화면이 받은 프레임 적용용)
+    void setCells(int y, int x, const Cell *source, int count)
+    {
+        if (y < 0 || y >= height || x < 0 || x >= width || count <= 0)
+            return;
+        count = std::min(count, width - x);
+        memcpy(&cells[static_cast<size_t>(y * width + x)], source, sizeof(Cell) * static_cast<size_t>(count));
+    }
+
+    // 한 줄의 글자만 (골든 비교 실패 메시지, 테스트용)
+    std::string rowText(int y) const
+    {
+        std::string text(static_cast<size_t>(width), ' ');
+        for (int x = 0; x < width; x++)
+        {
+            text[static_cast<size_t>(x)] = at(y, x).glyph;
+        }
+        return text;
+    }
+
+    // previous 와 다른 셀 수 (changes 가 있으면 바뀐 셀 목록도 채움)
+    // 크기가 다르면 -1
+    int diff(const FrameBuffer &previous, std::vector<CellChange> *changes = nullptr) const
+    {
+        if (previous.height != height || previous.width != width)
+        {
+            return -1;
+        }
+        int count = 0;
+        for (int y = 0; y < height; y++)
+        {
+            const Cell *row = &cells[static_cast<size_t>(y * width)];
+            const Cell *oldRow = &previous.cells[static_cast<size_t>(y * width)];
+            // 대부분의 줄은 그대로이므로 줄 단위로 먼저 비교
+            if (memcmp(row, oldRow, sizeof(Cell) * static_cast<size_t>(width)) == 0)
+            {
+                continue;
+            }
+            for (int x = 0; x < width; x++)
+            {
+                if (row[x] != oldRow[x])
+                {
+                    count++;
+                    if (changes)
+                    {
+                        changes->push_back({y, x, oldRow[x], row[x]});
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    bool operator==(const FrameBuffer &other) const { return diff(other) == 0; }
+    bool operator!=(const FrameBuffer &other) const { return !(*this == other); }
+
+    // 골든 프레임 텍스트
+    // 첫 줄 "frame <폭>x<높이>", 글자 줄 높이만큼, "--", 스타일 줄 높이만큼
+    // 스타일: 색 쌍 번호 0~f, 굵게(A_BOLD)면 A~P
+    std::string toGolden() const
+    {
+        std::string text = "frame " + std::to_string(width) + "x" + std::to_string(height) + "\n";
+        text.reserve(text.size() + static_cast<size_t>((width + 1) * (height * 2 + 1)));
+        for (int y = 0; y < height; y++)
+        {
+            text += rowText(y);
+            text += '\n';
+        }
+        text += "--\n";
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                text += styleChar(at(y, x));
+            }
+            text += '\n';
+        }
+        return text;
+    }
+
+    // toGolden() 텍스트를 다시 프레임으로 (형식이 틀리면 false)
+    static bool fromGolden(const std::string &text, FrameBuffer &out)
+    {
+        int cols = 0, rows = 0;
+        if (sscanf(text.c_str(), "frame %dx%d", &cols, &rows) != 2 || cols <= 0 || rows <= 0)
+        {
+            return false;
+        }
+        std::vector<std::string> lines;
+        size_t start = 0;
+        while (start < text.size())
+        {
+            size_t end = text.find('\n', start);
+            if (end == std::string::npos)
+                end = text.size();
+            lines.push_back(text.substr(start, end - start));
+            start = end + 1;
+        }
+        if (lines.size() < static_cast<size_t>(rows * 2 + 2) || lines[static_cast<size_t>(rows + 1)] != "--")
+        {
+            return false;
+        }
+
+        FrameBuffer frame(rows, cols);
+        for (int y = 0; y < rows; y++)
+        {
+            const std::string &glyphs = lines[static_cast<size_t>(1 + y)];
+            const std::string &styles = lines[static_cast<size_t>(rows + 2 + y)];
+            if (glyphs.size() != static_cast<size_t>(cols) || styles.size() != static_cast<size_t>(cols))
+            {
+                return false;
+            }
+            for (int x = 0; x < cols; x++)
+            {
+                Cell &cell = frame.cells[static_cast<size_t>(y * cols + x)];
+                char style = styles[static_cast<size_t>(x)];
+                cell.glyph = glyphs[static_cast<size_t>(x)];
+                if (style >= '0' && style <= '9')
+                    cell.pair = static_cast<uint16_t>(style - '0');
+                else if (style >= 'a' && style <= 'f')
+                    cell.pair = static_cast<uint16_t>(style - 'a' + 10);
+                else if (style >= 'A' && style <= 'P')
+                {
+                    cell.pair = static_cast<uint16_t>(style - 'A');
+                    cell.attrs = static_cast<uint32_t>(A_BOLD);
+                }
+                else
+                    return false;
+            }
+        }
+        out = frame;
+        return true;
+    }
+
+    // 골든 파일 비교 (파일이 없거나 다르면 false, report 에 첫 번째 다른 줄)
+    bool matchesGoldenFile(const char *path, std::string *report = nullptr) const
+    {
+        FILE *file = fopen(path, "rb");
+        if (!file)
+        {
+            if (report)
+                *report = std::string("cannot open ") + path;
+            return false;
+        }
+        std::string text;
+        char chunk[4096];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        {
+            text.append(chunk, n);
+        }
+        fclose(file);
+
+        FrameBuffer golden(1, 1);
+        if (!fromGolden(text, golden))
+        {
+            if (report)
+                *report = std::string("bad golden file ") + path;
+            return false;
+        }
+        std::vector<CellChange> changes;
+        int count = diff(golden, &changes);
+        if (count == 0)
+        {
+            return true;
+        }
+        if (report)
+        {
+            if (count < 0)
+            {
+                *report = "frame size differs from golden";
+            }
+            else
+            {
+                const CellChange &first = changes.front();
+                *report = std::to_string(count) + " cells differ, first at row " + std::to_string(first.y) +
+                          " col " + std::to_string(first.x) + "\n  golden: " + golden.rowText(first.y) +
+                          "\n  actual: " + rowText(first.y);
+            }
+        }
+        return false;
+    }
+
+    bool writeGoldenFile(const char *path) const
+    {
+        FILE *file = fopen(path, "wb");
+        if (!file)
+        {
+            return false;
+        }
+        std::string text = toGolden();
+        bool ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+        return fclose(file) == 0 && ok;
+    }
+};
+
+// FrameBuffer 의 창: 같은 셀 배열의 일부 (만든 FrameBuffer 보다 오래 쓰면 안 됨)
+class FrameBuffer::Window : public RenderTarget
+{
+private:
+    FrameBuffer &frame;
+    Area area;
+
+public:
+    Window(FrameBuffer &owner, const Area &windowArea) : frame(owner), area(windowArea) {}
+
+    int getHeight() const override { return area.rows; }
+    int getWidth() const override { return area.cols; }
+
+    void clear() override { frame.clearArea(area); }
+    void clearToEndOfLine(int y, int x) override
+    {
+        if (y >= 0 && y < area.rows && x >= 0 && x < area.cols)
+            frame.clearRow(area, y, x);
+    }
+    void attrOn(attr_t attrs) override { attrOnIn(area, attrs); }
+    void attrOff(attr_t attrs) override { attrOffIn(area, attrs); }
+    void vprint(int y, int x, const char *format, va_list args) override { frame.vprintIn(area, y, x, format, args); }
+    void putCells(int y, int x, const chtype *cells, int count) override { frame.putCellsIn(area, y, x, cells, count); }
+
+    void present() override {}
+    void stage() override {}
+    void flush() override {}
+
+    std::unique_ptr<RenderTarget> openWindow(int rows, int cols, int top, int left) override
+    {
+        return frame.openIn(area, rows, cols, top, left);
+    }
+};
+
+// newwin 처럼 화면(부모 영역)을 벗어나는 창은 만들지 않음
+inline std::unique_ptr<RenderTarget> FrameBuffer::openIn(const Area &parent, int rows, int cols, int top, int left)
+{
+    if (rows <= 0 || cols <= 0 || top < 0 || left < 0 || top + rows > parent.rows || left + cols > parent.cols)
+    {
+        return nullptr;
+    }
+    Area area = {parent.top + top, parent.left + left, rows, cols, 0, 0};
+    return std::unique_ptr<RenderTarget>(new Window(*this, area));
+}
+
+#endif // FRAMEBUFFER_H
@@ -0,0 +1,211 @@
+#ifndef FRAMETRACE_H
+#define FRAMETRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// FrameTrace: 프레임 단계별 구간(span)과 순간 이벤트를 Chrome trace-event JSON 으로 기록
+// SNOWMAN_TRACE_FILE 환경 변수에 파일 경로가 있을 때만 켜짐 (꺼져 있으면 구간마다 분기 하나)
+// - 스레드마다 고정 크기 링 버퍼를 하나씩 갖고, 기록은 자기 버퍼에 쓰고 개수만 올림 (잠금 없음)
+// - 아직 내보내지 않은 이벤트로 버퍼가 차면 그 뒤 이벤트는 버리고 개수만 셈
+// - writeFile() 이 지난번 이후의 이벤트를 JSON 으로 내보내고 그만큼 버퍼를 비움 (Perfetto / chrome://tracing 에서 열림)
+//   게임이 끝날 때마다 세션별 파일(trace.json -> trace-<pid>-<세션>.json)로 쓰므로 오래 켜 두어도 뒤 게임이 빠지지 않음
+//
+// 사용:
+//   { TraceSpan span("update", sessionId); ... }   // 구간 (중첩 가능)
+//   FrameTrace::instant("penalty", sessionId);        // 순간 이벤트
+// 이름은 문자열 리터럴만 (포인터만 저장함)
+class FrameTrace
+{
+public:
+    static const int EVENTS_PER_THREAD = 1 << 17;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Event
+    {
+        const char *name;
+        uint64_t startNanos;
+        uint64_t durationNanos;
+        int32_t session;
+        char phase; // 'X': 구간, 'i': 순간
+    };
+
+    struct ThreadBuffer
+    {
+        int threadId;
+        std::atomic<uint64_t> count{0};   // 지금까지 기록한 수 (칸 번호는 count % EVENTS_PER_THREAD)
+        std::atomic<uint64_t> flushed{0}; // 내보낸 수 (이보다 앞 칸은 다시 써도 됨)
+        std::atomic<uint64_t> dropped{0};
+        Event events[EVENTS_PER_THREAD];
+    };
+
+    const char *path;
+    Clock::time_point origin;
+    std::mutex buffersMutex; // 스레드 버퍼 등록/내보내기 때만 사용
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    FrameTrace() : path(getenv("SNOWMAN_TRACE_FILE")), origin(Clock::now())
+    {
+        if (path && !*path)
+            path = nullptr;
+    }
+
+    // 이 스레드의 버퍼 (처음 기록할 때 한 번 등록)
+    ThreadBuffer *threadBuffer()
+    {
+        thread_local ThreadBuffer *buffer = nullptr;
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.emplace_back(new ThreadBuffer());
+            buffer = buffers.back().get();
+            buffer->threadId = static_cast<int>(buffers.size());
+        }
+        return buffer;
+    }
+
+    void record(const char *name, char phase, uint64_t startNanos, uint64_t durationNanos, int session)
+    {
+        ThreadBuffer *buffer = threadBuffer();
+        uint64_t index = buffer->count.load(std::memory_order_relaxed);
+        if (index - buffer->flushed.load(std::memory_order_acquire) >= EVENTS_PER_THREAD)
+        {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        Event &event = buffer->events[index % EVENTS_PER_THREAD];
+        event.name = name;
+        event.startNanos = startNanos;
+        event.durationNanos = durationNanos;
+        event.session = session;
+        event.phase = phase;
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+public:
+    static FrameTrace &get()
+    {
+        static FrameTrace trace;
+        return trace;
+    }
+
+    static bool isEnabled()
+    {
+        static const bool enabled = get().path != nullptr;
+        return enabled;
+    }
+
+    uint64_t nowNanos() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count());
+    }
+
+    void span(const char *name, uint64_t startNanos, uint64_t endNanos, int session)
+    {
+        record(name, 'X', startNanos, endNanos - startNanos, session);
+    }
+
+    static void instant(const char *name, int session)
+    {
+        if (!isEnabled())
+            return;
+        FrameTrace &trace = get();
+        trace.record(name, 'i', trace.nowNanos(), 0, session);
+    }
+
+    // 지난번 writeFile() 이후 기록한 이벤트를 파일로 내보내고 버퍼에서 비움
+    // session 이 0 이상이면 세션별 파일 (경로가 .json 으로 끝나면 그 앞에 -<pid>-<세션> 을 붙임), 음수면 경로 그대로
+    bool writeFile(int session = -1)
+    {
+        if (!path)
+            return false;
+        int pid = static_cast<int>(getpid());
+        std::string filePath = path;
+        if (session >= 0)
+        {
+            std::string suffix = "-" + std::to_string(pid) + "-" + std::to_string(session);
+            size_t extension = filePath.size() >= 5 ? filePath.size() - 5 : std::string::npos;
+            if (extension != std::string::npos && filePath.compare(extension, 5, ".json") == 0)
+                filePath.insert(extension, suffix);
+            else
+                filePath += suffix + ".json";
+        }
+
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        FILE *file = fopen(filePath.c_str(), "w");
+        if (!file)
+            return false;
+
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"snowman\"}}", pid);
+        for (const auto &buffer : buffers)
+        {
+            fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                    pid, buffer->threadId, buffer->threadId);
+            // 다른 스레드가 계속 기록 중이어도 count 까지는 다 쓰인 이벤트
+            uint64_t from = buffer->flushed.load(std::memory_order_relaxed);
+            uint64_t count = buffer->count.load(std::memory_order_acquire);
+            for (uint64_t i = from; i < count; i++)
+            {
+                const Event &event = buffer->events[i % EVENTS_PER_THREAD];
+                fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f",
+                        event.name, event.phase, pid, buffer->threadId, event.startNanos / 1000.0);
+                if (event.phase == 'X')
+                    fprintf(file, ",\"dur\":%.3f", event.durationNanos / 1000.0);
+                else
+                    fprintf(file, ",\"s\":\"t\"");
+                fprintf(file, ",\"args\":{\"session\":%d}}", event.session);
+            }
+            // 다 읽은 뒤에 비움 (기록하는 스레드는 flushed 를 보고 앞 칸을 다시 씀)
+            buffer->flushed.store(count, std::memory_order_release);
+            uint64_t dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                fprintf(file, ",\n{\"name\":\"dropped events\",\"ph\":\"C\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"args\":{\"dropped\":%llu}}",
+                        pid, buffer->threadId, nowNanos() / 1000.0, static_cast<unsigned long long>(dropped));
+            }
+        }
+        fprintf(file, "\n]}\n");
+        return fclose(file) == 0;
+    }
+};
+
+// 구간 하나 (만들 때 시작, 소멸할 때 기록)
+class TraceSpan
+{
+private:
+    const char *name;
+    int session;
+    uint64_t startNanos;
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+public:
+    TraceSpan(const char *spanName, int sessionId) : name(spanName), session(sessionId), startNanos(0)
+    {
+        if (FrameTrace::isEnabled())
+            startNanos = FrameTrace::get().nowNanos();
+    }
+
+    ~TraceSpan()
+    {
+        if (FrameTrace::isEnabled())
+        {
+            FrameTrace &trace = FrameTrace::get();
+            trace.span(name, startNanos, trace.nowNanos(), session);
+        }
+    }
+};
+
+#endif // FRAMETRACE_H
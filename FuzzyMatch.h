@@ -0,0 +1,159 @@
+#ifndef FUZZYMATCH_H
+#define FUZZYMATCH_H
+
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+// FuzzyMatcher: 입력 하나와 여러 단어 사이의 레벤슈타인 거리 (대소문자 구분 없음)
+// Myers(1999)/Hyyrö(2001) 비트 병렬 방식: 단어의 DP 열 전체를 64비트 정수 하나(+/- 변화량 비트)로 들고
+// 입력 한 글자마다 비트 연산 열댓 개로 열을 갱신한다 (단어 길이와 상관없이 O(입력 길이) / 단어).
+// - setWords() 에서 단어마다 글자 위치 비트마스크(peq)를 미리 만들어 둠 (라운드를 만들 때 한 번, 할당은 여기서만)
+// - 여러 단어는 같은 글자의 peq 를 단어 순서로 붙여 두어 안쪽 반복이 연속 메모리를 훑음
+// - distances() 는 마지막 입력의 DP 상태를 들고 있어서, 입력 뒤에 글자가 붙기만 했으면 붙은 글자만 진행
+//   (타자 한 번 = 단어마다 한 걸음, 지우거나 고쳤을 때만 처음부터)
+// - 64자보다 긴 단어는 앞 64자만 비교
+class FuzzyMatcher
+{
+public:
+    static const int MAX_WORD_LENGTH = 64;
+    static const int MAX_TEXT_LENGTH = 64; // 이보다 긴 입력은 이어서 진행하지 않고 매번 처음부터
+
+private:
+    uint8_t classOf[256];                // 글자 -> 글자 종류 번호 (0: 어떤 단어에도 없는 글자)
+    int classCount;                      // 0 포함
+    int wordCount;
+    std::pmr::vector<uint64_t> peq;      // [글자 종류][단어]: 그 글자가 단어의 몇 번째에 있는지
+    std::pmr::vector<uint64_t> lastBit;  // 단어 마지막 글자의 비트
+    std::pmr::vector<int> lengths;
+    // distances() 의 마지막 입력과 그때의 단어별 상태 (Pv, Mv, 점수)
+    std::pmr::vector<uint64_t> positive;
+    std::pmr::vector<uint64_t> negative;
+    std::pmr::vector<int> scores;
+    char text[MAX_TEXT_LENGTH]; // 소문자로 바꾼 입력
+    int textLength;             // -1: 이어서 진행할 상태 없음
+
+    static unsigned char fold(char c) { return static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c))); }
+
+    // 한 글자 진행 (Hyyrö 의 전역 정렬 형태: 맨 윗줄이 글자마다 1씩 커지도록 Ph 에 1 을 넣음)
+    static void step(uint64_t eq, uint64_t last, uint64_t &pv, uint64_t &mv, int &score)
+    {
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        score += ((ph & last) != 0) - ((mh & last) != 0);
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+
+    static uint64_t lowBits(int length) { return length >= 64 ? ~uint64_t(0) : (uint64_t(1) << length) - 1; }
+
+public:
+    explicit FuzzyMatcher(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : classCount(1), wordCount(0), peq(resource), lastBit(resource), lengths(resource), positive(resource),
+          negative(resource), scores(resource), textLength(-1)
+    {
+        memset(classOf, 0, sizeof(classOf));
+    }
+
+    template <typename Words>
+    void setWords(const Words &words)
+    {
+        memset(classOf, 0, sizeof(classOf));
+        classCount = 1;
+        wordCount = static_cast<int>(words.size());
+        for (std::string_view word : words)
+        {
+            for (size_t i = 0; i < word.size() && i < MAX_WORD_LENGTH; i++)
+            {
+                unsigned char c = fold(word[i]);
+                if (classOf[c] == 0)
+                    classOf[c] = static_cast<uint8_t>(classCount++);
+            }
+        }
+
+        peq.assign(static_cast<size_t>(classCount) * wordCount, 0);
+        lastBit.assign(wordCount, 0);
+        lengths.assign(wordCount, 0);
+        positive.assign(wordCount, 0);
+        negative.assign(wordCount, 0);
+        scores.assign(wordCount, 0);
+        int index = 0;
+        for (std::string_view word : words)
+        {
+            int length = static_cast<int>(word.size() < MAX_WORD_LENGTH ? word.size() : MAX_WORD_LENGTH);
+            for (int i = 0; i < length; i++)
+                peq[static_cast<size_t>(classOf[fold(word[i])]) * wordCount + index] |= uint64_t(1) << i;
+            lengths[index] = length;
+            lastBit[index] = length > 0 ? uint64_t(1) << (length - 1) : 0;
+            index++;
+        }
+        textLength = -1;
+    }
+
+    int getWordCount() const { return wordCount; }
+
+    // 단어 하나와의 거리
+    int distance(int word, std::string_view input) const
+    {
+        int length = lengths[word];
+        if (length == 0)
+            return static_cast<int>(input.size());
+        uint64_t pv = lowBits(length);
+        uint64_t mv = 0;
+        int score = length;
+        for (char c : input)
+            step(peq[static_cast<size_t>(classOf[fold(c)]) * wordCount + word], lastBit[word], pv, mv, score);
+        return score;
+    }
+
+    // 모든 단어와의 거리 (단어 순서대로 wordCount 개, 다음 호출 전까지 유효)
+    const int *distances(std::string_view input)
+    {
+        // 앞 입력과 같은 앞부분까지는 그대로 두고 그 뒤 글자만 진행
+        int common = 0;
+        if (textLength >= 0)
+        {
+            while (common < textLength && common < static_cast<int>(input.size()) && text[common] == fold(input[common]))
+                common++;
+        }
+        if (textLength < 0 || common < textLength)
+        {
+            for (int w = 0; w < wordCount; w++)
+            {
+                positive[w] = lowBits(lengths[w]);
+                negative[w] = 0;
+                scores[w] = lengths[w];
+            }
+            common = 0;
+        }
+        for (size_t i = static_cast<size_t>(common); i < input.size(); i++)
+        {
+            const uint64_t *eq = &peq[static_cast<size_t>(classOf[fold(input[i])]) * wordCount];
+            for (int w = 0; w < wordCount; w++)
+                step(eq[w], lastBit[w], positive[w], negative[w], scores[w]);
+        }
+        for (int w = 0; w < wordCount; w++)
+        {
+            if (lengths[w] == 0)
+                scores[w] = static_cast<int>(input.size()); // 빈 단어는 위 반복에서 점수가 변하지 않음
+        }
+
+        textLength = -1;
+        if (input.size() <= MAX_TEXT_LENGTH)
+        {
+            for (size_t i = 0; i < input.size(); i++)
+                text[i] = static_cast<char>(fold(input[i]));
+            textLength = static_cast<int>(input.size());
+        }
+        return scores.data();
+    }
+};
+
+#endif // FUZZYMATCH_H
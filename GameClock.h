@@ -0,0 +1,70 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <ctime>
+#include <cstdint>
+#include <chrono>
+
+// GameClock: 게임 로직이 쓰는 시계
+// - 평소에는 실제 시간 (time(nullptr) 와 같은 기준)
+// - 헤드리스 시뮬레이션(봇, 튜너)에서는 스레드별 가상 시계로 바꿔서
+//   실제로 기다리지 않고 몇 분짜리 게임을 순식간에 돌릴 수 있음
+class GameClock
+{
+private:
+    static inline thread_local bool simulated = false;
+    static inline thread_local int64_t simulatedMillis = 0;
+
+public:
+    // 현재 시각 (밀리초, 유닉스 기준)
+    static int64_t nowMillis()
+    {
+        if (simulated)
+        {
+            return simulatedMillis;
+        }
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // 단조 시계 (밀리초, 기준점은 임의) - 타이머 휠처럼 간격만 재는 곳에서 사용
+    // 벽시계가 뒤로 돌아가도(NTP 보정, 수동 변경) 멈추거나 한꺼번에 몰리지 않음. 가상 시계에서는 nowMillis() 와 같음
+    static int64_t monotonicMillis()
+    {
+        if (simulated)
+        {
+            return simulatedMillis;
+        }
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // 현재 시각 (초) - 기존 time(nullptr) 대체
+    static time_t now()
+    {
+        return static_cast<time_t>(nowMillis() / 1000);
+    }
+
+    // 현재 스레드를 가상 시계로 전환
+    static void useSimulated(int64_t startMillis)
+    {
+        simulated = true;
+        simulatedMillis = startMillis;
+    }
+
+    // 가상 시계 진행 (실제 시계 사용 중이면 무시)
+    static void advance(int64_t millis)
+    {
+        if (simulated)
+        {
+            simulatedMillis += millis;
+        }
+    }
+
+    static void useReal() { simulated = false; }
+    static bool isSimulated() { return simulated; }
+};
+
+#endif // GAMECLOCK_H
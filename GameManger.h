@@ -1,12 +1,19 @@
 #ifndef GAMEMANAGER_H
 #define GAMEMANAGER_H
 
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <string>
 #include <vector>
 #include "SentenceManager.h"
 #include "WordBlock.h"
 #include "ItemBox.h"
+#include "GameClock.h"
+#include "GameTuning.h"
+#include "Metrics.h"
+#include "Probes.h"
+#include "FrameTrace.h"
 
 class GameManager
 {
@@ -21,8 +28,8 @@ private:
     int timePenaltySeconds;
     int timeAdjustment; // 아이템 효과로 조정된 시간 (초)
     int scoreMultiplier;
-    std::string lastItemEffectMessage;
-    time_t lastItemEffectTime;
+    char lastItemEffectMessage[32]; // 프레임마다 그리므로 std::string 대신 고정 버퍼
+    bool itemEffectVisible;         // 효과 문구 표시 중 (GameSession 의 타이머가 끔)
     int collectedSnowmen;
 
     // 시간 관련
@@ -34,17 +41,17 @@ private:
     // 게임 상태
     int currentLevel;
     bool gameRunning;
+    int sessionId; // 추적 지점(Probes.h)에 넘기는 세션 번호
 
-    // 단어 이동 제어
-    time_t lastWordRenderTime;
-    time_t lastWordCreateTime; // 추가: 단어 생성 시간 추적
-    int wordRenderInterval;
-    double wordCreateInterval; // 추가: 단어 생성 간격 (0.5초)
+    // 밸런스 수치 (제한시간, 생성/낙하 간격, 페널티, 아이템 효과)
+    GameTuning tuning;
+
+    // 단어 이동/생성 간격은 GameSession 이 타이머로 등록 (getTuning() 참고)
 
     // 단어 생성 제어 추가
-    int currentWordIndex;       // 현재 생성 중인 단어 인덱스 (0-7)   // 8개 단어 모두 생성 완료 여부
-    bool waitingForCompletion;  // 완성 대기 중인지
-    std::vector<int> wordOrder; // 랜덤 순서로 생성할 단어 인덱스 배열
+    int currentWordIndex;      // 현재 생성 중인 단어 인덱스 (0-7)   // 8개 단어 모두 생성 완료 여부
+    bool waitingForCompletion; // 완성 대기 중인지
+    // 랜덤 생성 순서는 라운드 데이터 (SentenceManager::getSpawnOrder)
 
     // 점수 계산 상수
     static const int SNOWFLAKE_POINTS = 100;
@@ -54,71 +61,35 @@ private:
 
 public:
     // 생성자
-    GameManager(int level) : currentLevel(level), totalScore(0), snowflakeScore(0),
-                             targetScore(0), timeBonus(0), levelBonus(0),
-                             gameRunning(false), timeUp(false),
-                             wordRenderInterval(1),
-                             lastWordRenderTime(0),
-                             lastWordCreateTime(0),
-                             wordCreateInterval(3.0), // 0.5초에서 3초로 변경
-                             currentWordIndex(0),
-                             timePenaltySeconds(0),
-                             timeAdjustment(0),
-                             scoreMultiplier(1),
-                             lastItemEffectTime(0),
-                             waitingForCompletion(false),
-                             collectedSnowmen(0)
+    GameManager(int level) : GameManager(level, GameTuning::forLevel(level)) {}
+
+    // 밸런스 수치를 직접 지정하는 생성자 (level_tuner 등)
+    GameManager(int level, const GameTuning &levelTuning)
+        : currentLevel(level), totalScore(0), snowflakeScore(0),
+          targetScore(0), timeBonus(0), levelBonus(0),
+          gameRunning(false), timeUp(false), sessionId(0),
+          tuning(levelTuning),
+          currentWordIndex(0),
+          timePenaltySeconds(0),
+          timeAdjustment(0),
+          scoreMultiplier(1),
+          itemEffectVisible(false),
+          waitingForCompletion(false),
+          collectedSnowmen(0)
     {
-        // 레벨에 따른 제한시간 설정
-        switch (level)
-        {
-        case 1:
-            timeLimit = 180;
-
-            break; // 3분
-        case 2:
-            timeLimit = 150;
-
-            break; // 2분 30초
-        case 3:
-            timeLimit = 120;
-
-            break; // 2분
-        default:
-            timeLimit = 180;
-            break;
-        }
-
-        // 랜덤 시드 초기화
-        srand(static_cast<unsigned>(time(nullptr)));
-
-        // 단어 순서 초기화 (0-7)
-        initializeWordOrder();
+        // 레벨에 따른 제한시간 설정 (GameTuning::forLevel 참고)
+        timeLimit = tuning.timeLimit;
+        remainingTime = timeLimit;
+        lastItemEffectMessage[0] = '\0';
     }
 
-    // 랜덤 단어 순서 생성
-    void initializeWordOrder()
-    {
-        wordOrder.clear();
-        // 0-7 인덱스를 순서대로 추가
-        for (int i = 0; i < 8; i++)
-        {
-            wordOrder.push_back(i);
-        }
-
-        // Fisher-Yates 셔플 알고리즘으로 랜덤하게 섞기
-        for (int i = 7; i > 0; i--)
-        {
-            int j = rand() % (i + 1);
-            std::swap(wordOrder[i], wordOrder[j]);
-        }
-    }
+    void setSessionId(int id) { sessionId = id; }
 
     // 게임 시작
     void startGame(SentenceManager *sentencemanager)
     {
 
-        startTime = time(nullptr);
+        startTime = GameClock::now();
         gameRunning = true;
         timeUp = false;
         totalScore = 0;
@@ -126,8 +97,6 @@ public:
         targetScore = 0;
         timeBonus = 0;
         levelBonus = currentLevel * LEVEL_BONUS_BASE;
-        lastWordRenderTime = startTime;
-        lastWordCreateTime = startTime;
         timePenaltySeconds = 0;
         timeAdjustment = 0;
         scoreMultiplier = 1;
@@ -138,11 +107,8 @@ public:
 
         waitingForCompletion = false;
 
-        // 새로운 랜덤 순서 생성
-        initializeWordOrder();
-
         // 첫 번째 단어 블록 즉시 생성 (랜덤 순서의 첫 번째)
-        sentencemanager->createWordBlock(60, wordOrder[currentWordIndex]);
+        sentencemanager->createWordBlock(60, sentencemanager->getSpawnOrder()[currentWordIndex]);
         currentWordIndex++;
     }
 
@@ -153,7 +119,7 @@ public:
         if (!gameRunning)
             return;
 
-        time_t currentTime = time(nullptr);
+        time_t currentTime = GameClock::now();
         int elapsedTime = (int)(currentTime - startTime);
         remainingTime = timeLimit - elapsedTime - timePenaltySeconds + timeAdjustment;
 
@@ -172,20 +138,28 @@ public:
         updateTotalScore();
     }
 
-    void addTargetScore()
+    // 문장 하나 완성: 오타로 인정된 단어(nearMisses)는 그 단어 몫의 nearMissPercent 만큼만
+    void addTargetScore(int nearMisses = 0)
     {
-        targetScore += TARGET_POINTS;
+        int perWord = TARGET_POINTS / Dictionary::WORDS_PER_SENTENCE;
+        targetScore += TARGET_POINTS - nearMisses * perWord * (100 - tuning.nearMissPercent) / 100;
         updateTotalScore();
     }
 
     // 시간 감소 (객체가 바닥에 떨어졌을 때 페널티)
-    void applyTimePenalty(int seconds = 10)
+    void applyTimePenalty() { applyTimePenalty(tuning.timePenaltySeconds); }
+
+    void applyTimePenalty(int seconds)
     {
         if (!gameRunning)
             return;
 
         timePenaltySeconds += seconds;
+        GameMetrics::get().timePenalties.add();
+        GameMetrics::get().timePenaltySeconds.add(static_cast<uint64_t>(seconds > 0 ? seconds : 0));
         updateTime();
+        SNOWMAN_PROBE3(time_penalty, sessionId, seconds, remainingTime);
+        FrameTrace::instant("penalty", sessionId);
 
         // 시간이 0 이하가 되면 게임 종료
         if (remainingTime <= 0)
@@ -219,18 +193,18 @@ public:
 
     int getRemainingTime() const { return remainingTime; }
     int getTimeLimit() const { return timeLimit; }
+    const GameTuning &getTuning() const { return tuning; }
     int getTimeAdjustment() const { return timeAdjustment; }
     bool isTimeUp() const { return timeUp; }
     bool isGameRunning() const { return gameRunning; }
 
-    // 시간 포맷팅 (MM:SS 형식)
-    std::string getFormattedTime() const
+    // 시간 포맷팅 (MM:SS 형식, 호출한 쪽 버퍼에 씀)
+    const char *formatTime(char *buffer, size_t size) const
     {
         int minutes = remainingTime / 60;
         int seconds = remainingTime % 60;
-        char buffer[16];
-        snprintf(buffer, sizeof(buffer), "%02d:%02d", minutes, seconds);
-        return std::string(buffer);
+        snprintf(buffer, size, "%02d:%02d", minutes, seconds);
+        return buffer;
     }
 
     // 게임 종료
@@ -247,60 +221,21 @@ public:
         return timeUp || !gameRunning;
     }
 
-    bool shouldUpdateWordBlocks()
+    // 단어 생성 타이머에서 호출: 미리 섞어둔 순서대로 다음 단어 생성 (완성 대기 중이면 건너뜀)
+    bool spawnNextWordBlock(SentenceManager *sentenceManager)
     {
-        time_t now = time(nullptr);
-        if (difftime(now, lastWordRenderTime) >= wordRenderInterval)
-        {
-            lastWordRenderTime = now;
-            return true;
-        }
-        return false;
-    }
-
-    bool shouldCreateWordBlock()
-    {
-        // 이미 8개 모두 생성했거나 완성 대기 중이면 생성하지 않음
         if (waitingForCompletion)
         {
             return false;
         }
 
-        time_t now = time(nullptr);
-        if (difftime(now, lastWordCreateTime) >= wordCreateInterval)
-        {
-            lastWordCreateTime = now;
-            return true;
-        }
-        return false;
+        currentWordIndex = currentWordIndex % 8;
+        int wordIndexToCreate = sentenceManager->getSpawnOrder()[currentWordIndex];
+        sentenceManager->createWordBlock(58, wordIndexToCreate);
+        currentWordIndex++;
+        return true;
     }
 
-    // 단어 생성 처리 (interface.h에서 호출)
-    bool handleWordGeneration(SentenceManager *sentenceManager)
-    {
-
-        if (shouldCreateWordBlock())
-        {
-            // 미리 섞어둔 순서대로 단어 생성
-            currentWordIndex = currentWordIndex % 8;
-            int wordIndexToCreate = wordOrder[currentWordIndex];
-            sentenceManager->createWordBlock(58, wordIndexToCreate);
-            currentWordIndex++;
-
-            return true;
-        }
-
-        // correctMatches가 8이 되면 새로운 문장으로 넘어가기
-        if (!waitingForCompletion && sentenceManager->getCorrectMatches() == 8)
-        {
-
-            waitingForCompletion = true;
-
-            return true;
-        }
-
-        return false;
-    }
     void notifySnowmanComplete()
     {
         // 이미 waitingForCompletion이면 무시
@@ -309,31 +244,25 @@ public:
 
         waitingForCompletion = true;
         collectedSnowmen++;
+        GameMetrics::get().roundsCompleted.add();
     }
     void prepareNextRound(SentenceManager *sentenceManager)
     {
-        // 새로운 문장 로드
+        // 새 문장을 불러오면 지난 라운드의 오타 인정 수가 지워지므로 먼저 읽어 둠
+        int nearMisses = sentenceManager->getNearMatches();
+
+        // 새로운 문장 로드 (이전 라운드의 단어/블록/생성 순서는 라운드 아레나와 함께 한 번에 해제,
+        // 입력칸 초기화와 새 랜덤 순서 생성도 여기서 처리)
         sentenceManager->loadRandomSentence(currentLevel);
 
         // 상태 완전 초기화
         currentWordIndex = 0;
         waitingForCompletion = false;
 
-        // 입력칸 초기화
-        sentenceManager->getInputHandler()->resetInputs();
-
-        // 단어 블록 초기화
-        auto &blocks = sentenceManager->getWordBlocks();
-        blocks.clear();
-
-        // 새로운 랜덤 순서 생성
-        initializeWordOrder();
-
         // 점수 추가
-        addTargetScore();
-
-        // 첫 단어 블록 생성
-        lastWordCreateTime = time(nullptr);
+        addTargetScore(nearMisses);
+        SNOWMAN_PROBE3(round_complete, sessionId, collectedSnowmen, totalScore);
+        FrameTrace::instant("round complete", sessionId);
     }
 
     void applyItemEffect(ItemBox::ItemType type)
@@ -341,22 +270,25 @@ public:
         switch (type)
         {
         case ItemBox::ItemType::TIME_BONUS:
-            timeAdjustment += 10;
-            lastItemEffectMessage = "TIME +10 SECONDS!";
+            timeAdjustment += tuning.itemTimeBonus;
+            snprintf(lastItemEffectMessage, sizeof(lastItemEffectMessage), "TIME +%d SECONDS!", tuning.itemTimeBonus);
+            GameMetrics::get().itemTimeBonus.add();
             break;
         case ItemBox::ItemType::TIME_MINUS:
-            timeAdjustment -= 10;
-            lastItemEffectMessage = "TIME -10 SECONDS!";
+            timeAdjustment -= tuning.itemTimeMinus;
+            snprintf(lastItemEffectMessage, sizeof(lastItemEffectMessage), "TIME -%d SECONDS!", tuning.itemTimeMinus);
+            GameMetrics::get().itemTimeMinus.add();
             break;
         case ItemBox::ItemType::SCORE_BOOST:
-            scoreMultiplier = 2;
-            lastItemEffectMessage = "SCORE MULTIPLIED!";
+            scoreMultiplier = tuning.itemScoreMultiplier;
+            snprintf(lastItemEffectMessage, sizeof(lastItemEffectMessage), "SCORE MULTIPLIED!");
+            GameMetrics::get().itemScoreBoost.add();
             break;
         default:
             break;
         }
 
-        lastItemEffectTime = time(nullptr);
+        itemEffectVisible = true;
 
         updateTime();
         updateTotalScore();
@@ -372,16 +304,10 @@ public:
     // Getter 추가
     int getCurrentWordIndex() const { return currentWordIndex; }
 
-    bool shouldDisplayItemEffect(double durationSeconds = 3.0) const
-    {
-        if (lastItemEffectTime == 0)
-        {
-            return false;
-        }
-        return difftime(time(nullptr), lastItemEffectTime) < durationSeconds;
-    }
+    bool shouldDisplayItemEffect() const { return itemEffectVisible; }
+    void hideItemEffect() { itemEffectVisible = false; }
 
-    const std::string &getLastItemEffectMessage() const { return lastItemEffectMessage; }
+    const char *getLastItemEffectMessage() const { return lastItemEffectMessage; }
 
     bool isWaitingForCompletion() const { return waitingForCompletion; }
 
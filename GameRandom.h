@@ -0,0 +1,29 @@
+#ifndef GAMERANDOM_H
+#define GAMERANDOM_H
+
+#include <cstdint>
+#include <random>
+
+// GameRandom: 게임 세션 하나가 쓰는 난수 생성기
+// 전역 rand()/srand() 대신 세션(GameSession)마다 하나씩 두고 SentenceManager, 단어 블록, 아이템 상자, 문장 샘플러에 넘긴다.
+// - 여러 세션을 스레드로 돌려도(level_tuner, bot_harness) 서로 섞이거나 잠금을 다투지 않음
+// - 같은 시드면 같은 게임이 재현됨 (--seed)
+typedef std::mt19937 GameRandom;
+
+// [0, bound) 안의 정수 (bound 가 1 이하면 0)
+inline int randomBelow(GameRandom &random, int bound)
+{
+    if (bound <= 1)
+    {
+        return 0;
+    }
+    return std::uniform_int_distribution<int>(0, bound - 1)(random);
+}
+
+// 시드를 주지 않은 세션(실제 게임)의 시드
+inline uint32_t randomSeed()
+{
+    return std::random_device()();
+}
+
+#endif // GAMERANDOM_H
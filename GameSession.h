@@ -0,0 +1,353 @@
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <string_view>
+#include "GameManger.h"
+#include "SentenceManager.h"
+#include "GameClock.h"
+#include "GameTuning.h"
+#include "ItemBox.h"
+#include "Metrics.h"
+#include "StringUtil.h"
+#include "TimerWheel.h"
+#include "Probes.h"
+#include "FrameTrace.h"
+#include "TypingAnalytics.h"
+#include "GameRandom.h"
+
+// GameSession: 게임 한 판의 시뮬레이션 (화면 그리기 없음)
+// PlayScreen 은 이 객체를 한 프레임마다 tick() 하고 그리기만 담당한다.
+// ncurses 화면 없이도 돌아가므로 봇/부하 테스트에서 그대로 사용할 수 있다.
+// 블록 낙하/생성, 아이템 박스, 완성 후 다음 라운드, 효과 문구 같은 시간 이벤트는 모두
+// 타이머 휠에 등록되어 tick() 에서는 만료된 것만 실행하고, 다음 만료 시각은 화면 루프가 대기 시간으로 씀.
+class GameSession
+{
+private:
+    int sessionId; // 프로세스 안에서 세션을 구분하는 번호 (로그/추적용)
+    int currentLevel;
+    int fieldWidth;  // 게임 영역 폭 (왼쪽)
+    int fieldHeight; // 전체 화면 높이 (게임 영역 바닥 계산용)
+
+    GameRandom random; // 이 세션의 난수 (전역 rand() 를 쓰지 않음, 같은 시드면 같은 게임)
+
+    GameManager *gameManager;         // 게임 상태 관리
+    SentenceManager *sentenceManager; // 단어 및 문장 관리
+
+    // 눈사람 완성 애니메이션 관련 상태
+    bool snowmanCompleted;
+    bool showCompletedSnowman;
+
+    // 시간 이벤트
+    TimerWheel timers;
+    TimerWheel::TimerId wordCreateTimer; // 다음 라운드 시작 시 다시 맞춤
+    TimerWheel::TimerId bannerTimer;     // 아이템 효과 문구 끄기 (효과가 다시 나오면 연장)
+
+    static const int COMPLETION_DELAY_MILLIS = 2000; // 완성된 눈사람을 보여주는 시간
+    static const int ITEM_BANNER_MILLIS = 3000;      // 아이템 효과 문구 표시 시간
+
+    bool finished; // 시간 초과 등으로 게임이 끝났는지
+
+    GameMetrics &metrics;
+    int reportedEntities; // entitiesAlive 게이지에 마지막으로 반영한 개수 (화면에 떠 있는 블록/상자만)
+
+    TypingAnalytics analytics; // 키 입력 흐름의 타자 지표 (SNOWMAN_ANALYTICS_DIR 이 있으면 세션 로그도)
+
+    GameSession(const GameSession &) = delete;
+    GameSession &operator=(const GameSession &) = delete;
+
+    static int nextSessionId()
+    {
+        static std::atomic<int> counter(0);
+        return ++counter;
+    }
+
+    static const char *analyticsDir()
+    {
+        static const char *dir = getenv("SNOWMAN_ANALYTICS_DIR");
+        return dir && *dir ? dir : nullptr;
+    }
+
+    static int64_t toMillis(double seconds)
+    {
+        int64_t millis = llround(seconds * 1000.0);
+        return millis > 0 ? millis : 1;
+    }
+
+    // 낙하 간격마다: 블록/박스 한 칸씩 내리고 바닥에 닿은 만큼 페널티
+    void onFallTimer()
+    {
+        TraceSpan span("fall", sessionId);
+        sentenceManager->advanceWordBlocks(fieldHeight - 3); // maxHeight 전달
+        if (sentenceManager->getTimePanalty())
+        {
+            gameManager->applyTimePenalty();
+            sentenceManager->setTimePanalty(false);
+        }
+        sentenceManager->advanceItemBoxes(fieldHeight - 3);
+    }
+
+    // 완성된 눈사람을 보여준 뒤: 입력칸 초기화 및 다음 문장
+    void onRoundFinished()
+    {
+        showCompletedSnowman = false;
+        snowmanCompleted = false;
+        // 입력칸 모두 비우기
+        sentenceManager->getInputHandler()->resetInputs();
+
+        gameManager->prepareNextRound(sentenceManager);
+        analytics.beginRound();
+        // 새 문장의 첫 단어는 지금부터 생성 간격 뒤
+        timers.restart(wordCreateTimer);
+    }
+
+    // 8단어를 모두 맞혔으면 완성 처리 후 다음 라운드 예약
+    void checkSnowmanComplete()
+    {
+        if (sentenceManager->getCorrectMatches() == 8 && !snowmanCompleted)
+        {
+            snowmanCompleted = true;
+            showCompletedSnowman = true;
+            gameManager->notifySnowmanComplete();
+            // 완성 연출 동안 다음 라운드를 미리 만들어 두어, 연출이 끝나는 프레임에서는 교체만 함
+            sentenceManager->stageNextRound(currentLevel);
+            timers.schedule(COMPLETION_DELAY_MILLIS, [this]()
+                            { onRoundFinished(); });
+        }
+    }
+
+    // 제출한 칸이 "random" 이면 떠 있는 아이템 상자 사용
+    void useItemIfRequested(int usedIndex)
+    {
+        auto handler = sentenceManager->getInputHandler();
+        if (!equalsIgnoreCase(handler->getInputAt(usedIndex), "random"))
+            return;
+
+        ItemBox::ItemType type;
+        if (sentenceManager->tryUseActiveItemBox(type))
+        {
+            gameManager->applyItemEffect(type);
+            FrameTrace::instant("item effect", sessionId);
+            handler->clearInput(usedIndex);
+            if (!timers.restart(bannerTimer))
+            {
+                bannerTimer = timers.schedule(ITEM_BANNER_MILLIS, [this]()
+                                              { gameManager->hideItemEffect(); });
+            }
+        }
+    }
+
+    // 떨어지고 있는 단어 블록과 아이템 상자 수 (입력칸에 들어갔거나 바닥에서 꺼진 것은 뺌)
+    int countActiveEntities() const
+    {
+        int count = 0;
+        for (const auto &block : sentenceManager->getWordBlocks())
+        {
+            if (block.getIsActive())
+                count++;
+        }
+        for (const auto &box : sentenceManager->getItemBoxes())
+        {
+            if (box.getIsActive())
+                count++;
+        }
+        return count;
+    }
+
+    bool hasActiveItemBox() const
+    {
+        for (const auto &box : sentenceManager->getItemBoxes())
+        {
+            if (box.getIsActive())
+                return true;
+        }
+        return false;
+    }
+
+    // 방금 처리한 키를 타자 지표에 반영 (lengthBefore: 키를 넣기 전 그 칸의 길이)
+    void recordKey(int64_t now, int key, int slot, size_t lengthBefore, bool submitted)
+    {
+        auto handler = sentenceManager->getInputHandler();
+        const auto &targetWords = sentenceManager->getTargetWords();
+        std::string_view target = slot < static_cast<int>(targetWords.size()) ? targetWords[slot] : std::string_view();
+        if (submitted)
+        {
+            analytics.onSubmit(now, slot, handler->isWordCorrect(slot, target), sentenceManager->getWordSpawnMillis(slot));
+        }
+        else if (key == KEY_BACKSPACE || key == 127 || key == 8)
+        {
+            analytics.onBackspace(now, slot);
+        }
+        else if (key >= 32 && key <= 126)
+        {
+            const std::string &input = handler->getInputAt(slot);
+            char expected = lengthBefore < target.size() ? target[lengthBefore] : '\0';
+            // 칸이 가득 차 들어가지 않은 글자, 아이템 상자가 떠 있을 때 치는 "random" 명령은 타자 지표에서 뺌
+            bool counted = input.size() > lengthBefore &&
+                           !(hasActiveItemBox() && startsWithIgnoreCase("random", input) && !startsWithIgnoreCase(target, input));
+            analytics.onCharacter(now, slot, static_cast<char>(key), expected, counted);
+        }
+    }
+
+public:
+    GameSession(int level, int areaWidth = 60, int areaHeight = 50)
+        : GameSession(level, GameTuning::forLevel(level), areaWidth, areaHeight) {}
+
+    // seed: 세션 난수의 시드 (봇/튜너가 재현하려고 넘김, 실제 게임은 randomSeed())
+    GameSession(int level, const GameTuning &tuning, int areaWidth = 60, int areaHeight = 50, uint32_t seed = randomSeed())
+        : sessionId(nextSessionId()), currentLevel(level), fieldWidth(areaWidth), fieldHeight(areaHeight),
+          random(seed), snowmanCompleted(false), showCompletedSnowman(false),
+          timers(GameClock::monotonicMillis()), wordCreateTimer(TimerWheel::NO_TIMER), bannerTimer(TimerWheel::NO_TIMER),
+          finished(false), metrics(GameMetrics::get()), reportedEntities(0),
+          analytics(GameClock::nowMillis(), analyticsDir() != nullptr)
+    {
+        metrics.sessionsActive.add(1);
+        gameManager = new GameManager(currentLevel, tuning);
+        sentenceManager = new SentenceManager(currentLevel, tuning, random);
+        gameManager->setSessionId(sessionId);
+        sentenceManager->setSessionId(sessionId);
+        gameManager->startGame(sentenceManager);
+
+        timers.schedulePeriodic(toMillis(tuning.wordRenderInterval), [this]()
+                                { onFallTimer(); });
+        wordCreateTimer = timers.schedulePeriodic(toMillis(tuning.wordCreateInterval), [this]()
+                                                  {
+                                                      TraceSpan span("spawn", sessionId);
+                                                      gameManager->spawnNextWordBlock(sentenceManager); });
+        timers.schedulePeriodic(toMillis(sentenceManager->getItemBoxInterval()), [this]()
+                                {
+                                    TraceSpan span("spawn item", sessionId);
+                                    sentenceManager->createItemBox(fieldWidth, fieldHeight - 3); });
+        // 남은 시간 표시가 바뀌는 초 경계마다 (화면 루프가 이때 깨어나 시계를 다시 그림)
+        timers.schedulePeriodic(1000, [this]()
+                                { gameManager->updateTime(); },
+                                1000 - GameClock::nowMillis() % 1000);
+    }
+
+    ~GameSession()
+    {
+        metrics.sessionsActive.add(-1);
+        metrics.entitiesAlive.add(-reportedEntities);
+        delete gameManager;
+        delete sentenceManager;
+    }
+
+    // 한 프레임 분량의 게임 로직 진행
+    void tick()
+    {
+        TraceSpan span("tick", sessionId);
+        auto tickStart = std::chrono::steady_clock::now();
+        int64_t nowMillis = GameClock::nowMillis();
+        SNOWMAN_PROBE2(tick_start, sessionId, nowMillis);
+        int timersFired = timers.advance(GameClock::monotonicMillis());
+
+        // 게임 종료 조건 확인
+        if (gameManager->checkGameEnd())
+        {
+            finished = true;
+        }
+
+        int entities = countActiveEntities();
+        if (entities != reportedEntities)
+        {
+            metrics.entitiesAlive.add(entities - reportedEntities);
+            reportedEntities = entities;
+        }
+        metrics.ticks.add();
+        SNOWMAN_PROBE2(tick_end, sessionId, timersFired);
+        metrics.tickSeconds.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tickStart).count()));
+    }
+
+    // 키 하나 처리 (ESC 는 화면 쪽에서 처리)
+    void handleKey(int key)
+    {
+        handleKeys(&key, 1);
+    }
+
+    // 한 프레임 동안 쌓인 키를 한 번에 처리
+    // 입력 칸 편집은 키 순서대로 InputHandler 에 넘기고, 정답 확인과 눈사람 완성 검사는 묶음 끝에 한 번만 한다.
+    void handleKeys(const int *keys, int count)
+    {
+        if (count <= 0)
+            return;
+
+        TraceSpan span("input", sessionId);
+        metrics.keystrokes.add(static_cast<uint64_t>(count));
+        auto handler = sentenceManager->getInputHandler();
+        int64_t now = GameClock::nowMillis();
+        bool submitted = false;
+        for (int i = 0; i < count; i++)
+        {
+            int key = keys[i];
+            switch (key)
+            {
+            case '\t': // TAB
+            case KEY_DOWN:
+                handler->nextInput();
+                analytics.onNavigate(now, handler->getCurrentInputIndex(), true);
+                break;
+            case KEY_UP:
+                handler->previousInput();
+                analytics.onNavigate(now, handler->getCurrentInputIndex(), false);
+                break;
+            default:
+            {
+                int usedIndex = handler->getCurrentInputIndex();
+                size_t lengthBefore = handler->getInputAt(usedIndex).size();
+                bool entered = handler->handleInput(key);
+                recordKey(now, key, usedIndex, lengthBefore, entered);
+                if (entered)
+                {
+                    // "random" 은 제출한 순간의 칸 내용으로 판단 (뒤따르는 키가 칸을 바꿀 수 있음)
+                    useItemIfRequested(usedIndex);
+                    submitted = true;
+                }
+            }
+            break;
+            }
+        }
+
+        if (submitted)
+        {
+            sentenceManager->checkAnswers();
+            checkSnowmanComplete();
+        }
+        sentenceManager->updateHint();
+    }
+
+    // 게임 종료 처리 (시간 보너스 계산, 타자 로그 쓰기)
+    void end()
+    {
+        gameManager->endGame();
+        analytics.writeLog(analyticsDir(), sessionId, currentLevel);
+    }
+
+    // Getter
+    int getId() const { return sessionId; }
+    int getLevel() const { return currentLevel; }
+    bool isFinished() const { return finished; }
+    bool isShowingCompletedSnowman() const { return showCompletedSnowman; }
+
+    // 다음 시간 이벤트까지 남은 밀리초 (화면 루프의 입력 대기 시간)
+    int millisUntilNextEvent() const
+    {
+        int64_t wait = timers.nextDeadline() - GameClock::monotonicMillis();
+        if (wait < 0)
+            return 0;
+        return wait > INT_MAX ? INT_MAX : static_cast<int>(wait);
+    }
+    const TimerWheel &getTimers() const { return timers; }
+    TypingAnalytics &getAnalytics() { return analytics; }
+    GameManager *getGameManager() const { return gameManager; }
+    SentenceManager *getSentenceManager() const { return sentenceManager; }
+};
+
+#endif // GAMESESSION_H
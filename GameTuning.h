@@ -0,0 +1,48 @@
+#ifndef GAMETUNING_H
+#define GAMETUNING_H
+
+// GameTuning: 레벨 밸런스를 결정하는 수치 모음
+// 기본값은 지금까지 코드에 박혀 있던 값과 같고, level_tuner 가 이 값들을 바꿔 가며 시뮬레이션한다.
+struct GameTuning
+{
+    int timeLimit;             // 제한시간 (초)
+    int wordRenderInterval;    // 단어 블록이 한 칸 내려가는 간격 (초)
+    double wordCreateInterval; // 단어 블록 생성 간격 (초)
+    double itemBoxInterval;    // 아이템 박스 생성 간격 (초)
+    int timePenaltySeconds;    // 단어가 바닥에 닿았을 때 깎이는 시간 (초)
+    int itemTimeBonus;         // TIME_BONUS 아이템: 늘어나는 시간 (초)
+    int itemTimeMinus;         // TIME_MINUS 아이템: 줄어드는 시간 (초)
+    int itemScoreMultiplier;   // SCORE_BOOST 아이템: 점수 배수
+    int typoTolerance;         // 이 편집 거리 이하의 오타는 맞힌 것으로 인정 (0: 정확히 같아야 함, 짧은 단어는 더 적게)
+    int nearMissPercent;       // 오타로 인정된 단어가 받는 점수 비율 (%)
+
+    GameTuning() : timeLimit(180), wordRenderInterval(1), wordCreateInterval(3.0),
+                   itemBoxInterval(30.0), timePenaltySeconds(10),
+                   itemTimeBonus(10), itemTimeMinus(10), itemScoreMultiplier(2),
+                   typoTolerance(1), nearMissPercent(50) {}
+
+    // 레벨별 기본값
+    static GameTuning forLevel(int level)
+    {
+        GameTuning tuning;
+        switch (level)
+        {
+        case 1:
+            tuning.timeLimit = 180; // 3분
+            break;
+        case 2:
+            tuning.timeLimit = 150; // 2분 30초
+            break;
+        case 3:
+            tuning.timeLimit = 120; // 2분
+            tuning.typoTolerance = 0; // 가장 어려운 레벨은 정확히 쳐야 함
+            break;
+        default:
+            tuning.timeLimit = 180;
+            break;
+        }
+        return tuning;
+    }
+};
+
+#endif // GAMETUNING_H
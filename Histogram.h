@@ -0,0 +1,118 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cstdint>
+#include <cstring>
+
+// Histogram: 지연 시간 등 양의 정수 값을 위한 로그-선형 히스토그램
+// - 2의 거듭제곱 구간마다 16칸 (상대 오차 약 6% 이내)
+// - 고정 크기 배열이라 기록할 때 메모리 할당이 없고 O(1)
+// - 스레드별로 따로 기록한 뒤 merge() 로 합칠 수 있음
+class Histogram
+{
+public:
+    static const int SUB_BUCKETS = 16;
+    static const int BUCKET_COUNT = 61 * SUB_BUCKETS;
+
+private:
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total;
+    uint64_t sum;
+    uint64_t minValue;
+    uint64_t maxValue;
+
+    static int bucketOf(uint64_t value)
+    {
+        if (value < SUB_BUCKETS)
+        {
+            return static_cast<int>(value);
+        }
+        int exponent = 63 - __builtin_clzll(value); // 4 이상
+        int mantissa = static_cast<int>((value >> (exponent - 4)) & (SUB_BUCKETS - 1));
+        return (exponent - 3) * SUB_BUCKETS + mantissa;
+    }
+
+    // 구간에 들어가는 가장 큰 값
+    static uint64_t bucketUpper(int bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+        {
+            return static_cast<uint64_t>(bucket);
+        }
+        int exponent = bucket / SUB_BUCKETS + 3;
+        uint64_t mantissa = static_cast<uint64_t>(bucket % SUB_BUCKETS);
+        uint64_t lower = (SUB_BUCKETS + mantissa) << (exponent - 4);
+        return lower + ((uint64_t(1) << (exponent - 4)) - 1);
+    }
+
+public:
+    Histogram() { reset(); }
+
+    void reset()
+    {
+        memset(counts, 0, sizeof(counts));
+        total = 0;
+        sum = 0;
+        minValue = UINT64_MAX;
+        maxValue = 0;
+    }
+
+    void record(uint64_t value)
+    {
+        counts[bucketOf(value)]++;
+        total++;
+        sum += value;
+        if (value < minValue)
+            minValue = value;
+        if (value > maxValue)
+            maxValue = value;
+    }
+
+    void merge(const Histogram &other)
+    {
+        for (int i = 0; i < BUCKET_COUNT; i++)
+        {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        if (other.minValue < minValue)
+            minValue = other.minValue;
+        if (other.maxValue > maxValue)
+            maxValue = other.maxValue;
+    }
+
+    // p: 0~100 (예: 99.0 -> p99)
+    uint64_t percentile(double p) const
+    {
+        if (total == 0)
+        {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(total) + 0.5);
+        if (rank < 1)
+            rank = 1;
+        if (rank > total)
+            rank = total;
+
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++)
+        {
+            seen += counts[i];
+            if (seen >= rank)
+            {
+                uint64_t upper = bucketUpper(i);
+                return upper < maxValue ? upper : maxValue;
+            }
+        }
+        return maxValue;
+    }
+
+    uint64_t getCount() const { return total; }
+    uint64_t getSum() const { return sum; }
+    uint64_t getMin() const { return total ? minValue : 0; }
+    uint64_t getMax() const { return maxValue; }
+    double getMean() const { return total ? static_cast<double>(sum) / static_cast<double>(total) : 0.0; }
+};
+
+#endif // HISTOGRAM_H
@@ -2,6 +2,7 @@
 #define ITEMBOX_H
 
 #include "FallingObject.h"
+#include "GameRandom.h"
 #include <cmath>
 #include <string>
 
@@ -22,14 +23,14 @@ private:
     double fallAccumulator;
 
 public:
-    ItemBox(int areaWidth, int areaHeight, double speed = 0.8)
+    ItemBox(int areaWidth, int areaHeight, GameRandom &random, double speed = 0.8)
         : FallingObject(areaWidth, areaHeight, speed), fallAccumulator(0.0)
     {
         // 랜덤 아이템 타입 결정
-        itemType = static_cast<ItemType>(rand() % 3);
+        itemType = static_cast<ItemType>(randomBelow(random, 3));
 
         // 랜덤 x 위치 (아이템 박스는 3칸 폭: [?])
-        x = rand() % (gameAreaWidth - 4) + 1;
+        x = randomBelow(random, gameAreaWidth - 4) + 1;
         initialX = x;
     }
 
@@ -0,0 +1,96 @@
+#ifndef LATENCYTRACER_H
+#define LATENCYTRACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include "Histogram.h"
+
+// LatencyTracer: 키 입력부터 그 입력이 처음 화면에 나타날 때까지의 지연 측정
+// - getch() 가 키를 돌려준 순간 keyRead() 로 시각을 찍고
+// - 다음 프레임의 refresh() 직후 framePresented() 에서 대기 중인 키들의 지연을 기록
+// - 게임이 끝나면 세션별 p50/p95/p99/max 를 로그 파일에 한 줄로 추가
+// SNOWMAN_LATENCY_LOG 환경 변수에 파일 경로가 있을 때만 켜짐
+class LatencyTracer
+{
+private:
+    static const int MAX_PENDING = 256; // 한 프레임 사이에 쌓일 수 있는 키 수
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct PendingKey
+    {
+        int key;
+        Clock::time_point readAt;
+    };
+
+    const char *logPath;
+    PendingKey pending[MAX_PENDING];
+    int pendingCount;
+    uint64_t frameNumber;
+    uint64_t droppedKeys;
+    Histogram latencyNanos;
+
+public:
+    LatencyTracer() : logPath(getenv("SNOWMAN_LATENCY_LOG")), pendingCount(0), frameNumber(0), droppedKeys(0) {}
+
+    bool isEnabled() const { return logPath != nullptr; }
+
+    // getch() 가 키를 돌려준 직후 호출
+    void keyRead(int key)
+    {
+        if (!logPath)
+            return;
+        if (pendingCount >= MAX_PENDING)
+        {
+            droppedKeys++;
+            return;
+        }
+        pending[pendingCount].key = key;
+        pending[pendingCount].readAt = Clock::now();
+        pendingCount++;
+    }
+
+    // 프레임을 화면에 내보낸 (refresh) 직후 호출
+    void framePresented()
+    {
+        frameNumber++;
+        if (!logPath || pendingCount == 0)
+            return;
+
+        Clock::time_point now = Clock::now();
+        for (int i = 0; i < pendingCount; i++)
+        {
+            latencyNanos.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - pending[i].readAt).count()));
+        }
+        pendingCount = 0;
+    }
+
+    const Histogram &getHistogram() const { return latencyNanos; }
+
+    // 세션 요약을 로그 파일 끝에 한 줄 추가
+    void exportSession(int sessionId, int level) const
+    {
+        if (!logPath)
+            return;
+        FILE *file = fopen(logPath, "a");
+        if (!file)
+            return;
+        fprintf(file,
+                "session=%d-%d level=%d frames=%llu keys=%llu dropped=%llu "
+                "p50_us=%.1f p95_us=%.1f p99_us=%.1f max_us=%.1f mean_us=%.1f\n",
+                static_cast<int>(getpid()), sessionId, level,
+                static_cast<unsigned long long>(frameNumber),
+                static_cast<unsigned long long>(latencyNanos.getCount()),
+                static_cast<unsigned long long>(droppedKeys),
+                latencyNanos.percentile(50) / 1000.0, latencyNanos.percentile(95) / 1000.0,
+                latencyNanos.percentile(99) / 1000.0, latencyNanos.getMax() / 1000.0,
+                latencyNanos.getMean() / 1000.0);
+        fclose(file);
+    }
+};
+
+#endif // LATENCYTRACER_H
@@ -0,0 +1,448 @@
+#include "Leaderboard.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace
+{
+    const uint32_t RECORD_MAGIC = 0x534e4f57; // "SNOW"
+    const uint32_t INDEX_MAGIC = 0x58444953;  // "SIDX"
+    const uint32_t INDEX_VERSION = 2;
+
+    struct IndexHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        int32_t level;
+        uint32_t count;
+        uint64_t coveredLogSize; // 이 색인이 반영한 로그 크기 (바이트)
+        uint32_t levelCount;     // 같은 compact 에서 만든 색인 수 (빠진 레벨 색인을 알아채는 용도)
+        uint32_t reserved;
+    };
+
+    int64_t nowMillis()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    bool higherScore(const ScoreEntry &a, const ScoreEntry &b)
+    {
+        return a.score != b.score ? a.score > b.score : a.timestamp < b.timestamp;
+    }
+
+    // 내림차순 배열에서 score 보다 높은 점수의 개수
+    uint32_t countAbove(const ScoreEntry *entries, uint32_t count, int score)
+    {
+        const ScoreEntry *end = std::partition_point(entries, entries + count, [score](const ScoreEntry &e)
+                                                     { return e.score > score; });
+        return static_cast<uint32_t>(end - entries);
+    }
+}
+
+uint32_t Leaderboard::checksumOf(const ScoreRecord &record)
+{
+    // checksum 필드 앞부분의 FNV-1a
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&record);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ScoreRecord, checksum); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::string Leaderboard::defaultDirectory()
+{
+    const char *dir = getenv("SNOWMAN_SCORE_DIR");
+    if (dir && *dir)
+    {
+        return dir;
+    }
+    const char *home = getenv("HOME");
+    if (home && *home)
+    {
+        return std::string(home) + "/.snowman_scores";
+    }
+    return "snowman_scores";
+}
+
+Leaderboard::Leaderboard(const std::string &dir)
+    : directory(dir), logFd(-1), indexedLogSize(0), unsynced(0), lastSyncMillis(nowMillis()), syncing(false)
+{
+    mkdir(directory.c_str(), 0755);
+    logFd = open(logPath().c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    // 이전에 쓰다가 끊긴 기록이 있으면 다음 기록이 32바이트 경계에서 시작하도록 채움
+    struct stat st;
+    if (logFd >= 0 && fstat(logFd, &st) == 0 && st.st_size % static_cast<off_t>(sizeof(ScoreRecord)) != 0)
+    {
+        char padding[sizeof(ScoreRecord)] = {0};
+        size_t missing = sizeof(ScoreRecord) - static_cast<size_t>(st.st_size % static_cast<off_t>(sizeof(ScoreRecord)));
+        if (write(logFd, padding, missing) < 0)
+        {
+            close(logFd);
+            logFd = -1;
+        }
+    }
+
+    refresh();
+}
+
+Leaderboard::~Leaderboard()
+{
+    flush();
+    unmapAll();
+    if (logFd >= 0)
+    {
+        close(logFd);
+    }
+}
+
+// ========== 쓰기 ==========
+
+bool Leaderboard::submit(int level, int score)
+{
+    if (logFd < 0)
+    {
+        return false;
+    }
+
+    ScoreRecord record;
+    memset(&record, 0, sizeof(record));
+    record.magic = RECORD_MAGIC;
+    record.level = level;
+    record.score = score;
+    record.timestamp = static_cast<int64_t>(time(nullptr));
+    record.pid = static_cast<uint32_t>(getpid());
+    record.checksum = checksumOf(record);
+
+    // O_APPEND + 한 번의 write: 다른 세션의 기록과 섞이지 않음 (잠금 불필요)
+    if (write(logFd, &record, sizeof(record)) != static_cast<ssize_t>(sizeof(record)))
+    {
+        return false;
+    }
+
+    unsynced++;
+    maybeSync();
+    return true;
+}
+
+void Leaderboard::maybeSync()
+{
+    bool batchFull = unsynced.load() >= SYNC_BATCH;
+    bool intervalPassed = nowMillis() - lastSyncMillis.load() >= SYNC_INTERVAL_MS;
+    if (!batchFull && !intervalPassed)
+    {
+        return;
+    }
+
+    // 한 스레드만 fsync (나머지는 기다리지 않고 바로 돌아감)
+    if (syncing.exchange(true))
+    {
+        return;
+    }
+    unsynced = 0;
+    fdatasync(logFd);
+    lastSyncMillis = nowMillis();
+    syncing = false;
+}
+
+void Leaderboard::flush()
+{
+    if (logFd >= 0 && unsynced.exchange(0) > 0)
+    {
+        fdatasync(logFd);
+        lastSyncMillis = nowMillis();
+    }
+}
+
+// ========== 색인 ==========
+
+bool Leaderboard::readLog(uint64_t fromOffset, std::map<int, std::vector<ScoreEntry>> &out, uint64_t &endOffset) const
+{
+    endOffset = fromOffset;
+    int fd = open(logPath().c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const size_t BATCH = 1024;
+    std::vector<ScoreRecord> records(BATCH);
+    off_t offset = static_cast<off_t>(fromOffset);
+    while (true)
+    {
+        ssize_t got = pread(fd, records.data(), BATCH * sizeof(ScoreRecord), offset);
+        if (got <= 0)
+        {
+            break;
+        }
+        size_t whole = static_cast<size_t>(got) / sizeof(ScoreRecord); // 쓰는 중인 조각은 제외
+        for (size_t i = 0; i < whole; i++)
+        {
+            const ScoreRecord &record = records[i];
+            if (record.magic != RECORD_MAGIC || record.checksum != checksumOf(record))
+            {
+                continue; // 끊긴 기록을 채운 부분 등
+            }
+            ScoreEntry entry;
+            entry.score = record.score;
+            entry.reserved = 0;
+            entry.timestamp = record.timestamp;
+            out[record.level].push_back(entry);
+        }
+        offset += static_cast<off_t>(whole * sizeof(ScoreRecord));
+        if (whole < BATCH)
+        {
+            break;
+        }
+    }
+    close(fd);
+    endOffset = static_cast<uint64_t>(offset);
+    return true;
+}
+
+bool Leaderboard::compact()
+{
+    std::map<int, std::vector<ScoreEntry>> all;
+    uint64_t endOffset = 0;
+    if (!readLog(0, all, endOffset))
+    {
+        return false;
+    }
+
+    bool ok = true;
+    for (auto &entry : all)
+    {
+        std::vector<ScoreEntry> &scores = entry.second;
+        std::sort(scores.begin(), scores.end(), higherScore);
+
+        IndexHeader header;
+        header.magic = INDEX_MAGIC;
+        header.version = INDEX_VERSION;
+        header.level = entry.first;
+        header.count = static_cast<uint32_t>(scores.size());
+        header.coveredLogSize = endOffset;
+        header.levelCount = static_cast<uint32_t>(all.size());
+        header.reserved = 0;
+
+        // 프로세스별 임시 파일에 쓰고 rename 으로 교체 (읽는 쪽은 항상 완성된 색인만 봄)
+        std::string path = indexPath(entry.first);
+        std::string tempPath = path + ".tmp." + std::to_string(getpid());
+        FILE *file = fopen(tempPath.c_str(), "wb");
+        if (!file)
+        {
+            ok = false;
+            continue;
+        }
+        bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                       (scores.empty() || fwrite(scores.data(), sizeof(ScoreEntry), scores.size(), file) == scores.size());
+        written = (fclose(file) == 0) && written;
+        if (!written || rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            unlink(tempPath.c_str());
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void Leaderboard::unmapAll()
+{
+    for (auto &entry : levels)
+    {
+        if (entry.second.mapped)
+        {
+            munmap(const_cast<unsigned char *>(entry.second.mapped), entry.second.mappedSize);
+        }
+    }
+    levels.clear();
+}
+
+bool Leaderboard::mapIndex(int level, LevelIndex &index, uint64_t &coveredLogSize, uint32_t &levelCount)
+{
+    int fd = open(indexPath(level).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(IndexHeader)))
+    {
+        close(fd);
+        return false;
+    }
+    void *mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const IndexHeader *header = static_cast<const IndexHeader *>(mapped);
+    size_t size = static_cast<size_t>(st.st_size);
+    if (header->magic != INDEX_MAGIC || header->version != INDEX_VERSION || header->level != level ||
+        sizeof(IndexHeader) + static_cast<size_t>(header->count) * sizeof(ScoreEntry) > size)
+    {
+        munmap(mapped, size);
+        return false;
+    }
+
+    index.mapped = static_cast<const unsigned char *>(mapped);
+    index.mappedSize = size;
+    index.entries = reinterpret_cast<const ScoreEntry *>(index.mapped + sizeof(IndexHeader));
+    index.count = header->count;
+    coveredLogSize = header->coveredLogSize;
+    levelCount = header->levelCount;
+    return true;
+}
+
+void Leaderboard::refresh()
+{
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        unmapAll();
+
+        // 디렉터리에서 level<N>.idx 찾기
+        std::map<int, uint64_t> covered;
+        uint32_t expectedLevels = 0; // 색인들이 말하는 레벨 수 (찾은 색인보다 많으면 어떤 레벨 색인이 없음)
+        DIR *dir = opendir(directory.c_str());
+        if (dir)
+        {
+            while (struct dirent *item = readdir(dir))
+            {
+                int level = 0;
+                char suffix[8] = {0};
+                if (sscanf(item->d_name, "level%d.%4s", &level, suffix) == 2 && strcmp(suffix, "idx") == 0 &&
+                    strlen(item->d_name) == std::to_string(level).size() + 9)
+                {
+                    uint64_t coveredSize = 0;
+                    uint32_t levelCount = 0;
+                    if (mapIndex(level, levels[level], coveredSize, levelCount))
+                    {
+                        covered[level] = coveredSize;
+                        expectedLevels = std::max(expectedLevels, levelCount);
+                    }
+                    else
+                    {
+                        levels.erase(level);
+                    }
+                }
+            }
+            closedir(dir);
+        }
+
+        // 색인 이후의 기록 읽기 (레벨마다 자기 색인이 반영한 위치 이후만)
+        uint64_t from = UINT64_MAX;
+        for (const auto &entry : covered)
+        {
+            from = std::min(from, entry.second);
+        }
+        if (from == UINT64_MAX)
+        {
+            from = 0;
+        }
+        indexedLogSize = from;
+
+        std::map<int, std::vector<ScoreEntry>> tail;
+        uint64_t endOffset = from;
+        size_t tailCount = 0;
+        if (readLog(from, tail, endOffset))
+        {
+            // compact 중 색인 쓰기가 실패한 레벨은 색인이 없으므로 from 앞의 기록까지 로그 전체에서 읽음
+            if (from > 0 && expectedLevels > covered.size())
+            {
+                std::map<int, std::vector<ScoreEntry>> full;
+                uint64_t ignored = 0;
+                readLog(0, full, ignored);
+                for (auto &entry : full)
+                {
+                    if (covered.find(entry.first) == covered.end())
+                    {
+                        tail[entry.first].swap(entry.second);
+                    }
+                }
+            }
+            for (auto &entry : tail)
+            {
+                // 레벨별 색인 위치가 다를 수 있으므로 (동시 compact) 이미 반영된 부분은 건너뜀
+                auto it = covered.find(entry.first);
+                if (it != covered.end() && it->second > from)
+                {
+                    std::map<int, std::vector<ScoreEntry>> redo;
+                    uint64_t ignored = 0;
+                    readLog(it->second, redo, ignored);
+                    entry.second.swap(redo[entry.first]);
+                }
+                std::sort(entry.second.begin(), entry.second.end(), higherScore);
+                tailCount += entry.second.size();
+                levels[entry.first].tail.swap(entry.second);
+            }
+        }
+
+        if (tailCount <= static_cast<size_t>(COMPACT_TAIL) || attempt > 0 || !compact())
+        {
+            return;
+        }
+    }
+}
+
+// ========== 조회 (메모리만 사용) ==========
+
+std::vector<ScoreEntry> Leaderboard::topK(int level, int k) const
+{
+    std::vector<ScoreEntry> result;
+    auto it = levels.find(level);
+    if (it == levels.end() || k <= 0)
+    {
+        return result;
+    }
+
+    const LevelIndex &index = it->second;
+    result.reserve(static_cast<size_t>(k));
+    uint32_t i = 0;
+    size_t j = 0;
+    while (static_cast<int>(result.size()) < k && (i < index.count || j < index.tail.size()))
+    {
+        bool takeIndex = j >= index.tail.size() ||
+                         (i < index.count && !higherScore(index.tail[j], index.entries[i]));
+        result.push_back(takeIndex ? index.entries[i++] : index.tail[j++]);
+    }
+    return result;
+}
+
+int Leaderboard::rankOf(int level, int score) const
+{
+    auto it = levels.find(level);
+    if (it == levels.end())
+    {
+        return 1;
+    }
+    const LevelIndex &index = it->second;
+    uint32_t above = countAbove(index.entries, index.count, score) +
+                     countAbove(index.tail.data(), static_cast<uint32_t>(index.tail.size()), score);
+    return static_cast<int>(above) + 1;
+}
+
+int Leaderboard::countOf(int level) const
+{
+    auto it = levels.find(level);
+    if (it == levels.end())
+    {
+        return 0;
+    }
+    return static_cast<int>(it->second.count + it->second.tail.size());
+}
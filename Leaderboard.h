@@ -0,0 +1,107 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// ===== 로컬 리더보드 저장소 =====
+// scores.log   : 추가만 하는 고정 크기(32바이트) 점수 기록. O_APPEND 한 번의 write 라서
+//                여러 세션/프로세스가 잠금 없이 동시에 기록해도 섞이지 않음
+// level<N>.idx : 레벨별로 점수 내림차순 정렬된 색인. compact() 가 로그에서 다시 만들고
+//                rename 으로 교체하며, 읽을 때는 mmap 해서 그대로 사용
+// 색인 이후에 추가된 기록(tail)은 refresh() 때 작은 정렬 배열로 읽어 와 함께 조회한다.
+// (색인 쓰기가 실패해 색인이 없는 레벨은 로그 전체에서 읽음)
+// fsync 는 기록마다 하지 않고 SYNC_BATCH 개 또는 SYNC_INTERVAL_MS 마다 한 번.
+
+struct ScoreRecord
+{
+    uint32_t magic;
+    int32_t level;
+    int32_t score;
+    uint32_t reserved;
+    int64_t timestamp; // 유닉스 시각 (초)
+    uint32_t pid;
+    uint32_t checksum;
+};
+
+struct ScoreEntry
+{
+    int32_t score;
+    uint32_t reserved;
+    int64_t timestamp;
+};
+
+class Leaderboard
+{
+public:
+    static const int SYNC_BATCH = 64;
+    static const int SYNC_INTERVAL_MS = 1000;
+    static const int COMPACT_TAIL = 4096; // tail 이 이보다 길면 refresh 때 색인을 다시 만듦
+
+private:
+    // mmap 한 레벨 색인 + 색인 이후의 기록
+    struct LevelIndex
+    {
+        const unsigned char *mapped = nullptr;
+        size_t mappedSize = 0;
+        const ScoreEntry *entries = nullptr; // 내림차순
+        uint32_t count = 0;
+        std::vector<ScoreEntry> tail; // 내림차순
+    };
+
+    std::string directory;
+    int logFd;
+    std::map<int, LevelIndex> levels;
+    uint64_t indexedLogSize; // 색인이 반영한 로그 크기 (바이트)
+
+    std::atomic<int> unsynced;
+    std::atomic<int64_t> lastSyncMillis;
+    std::atomic<bool> syncing;
+
+    Leaderboard(const Leaderboard &) = delete;
+    Leaderboard &operator=(const Leaderboard &) = delete;
+
+    std::string logPath() const { return directory + "/scores.log"; }
+    std::string indexPath(int level) const { return directory + "/level" + std::to_string(level) + ".idx"; }
+
+    static uint32_t checksumOf(const ScoreRecord &record);
+    void unmapAll();
+    bool mapIndex(int level, LevelIndex &index, uint64_t &coveredLogSize, uint32_t &levelCount);
+    bool readLog(uint64_t fromOffset, std::map<int, std::vector<ScoreEntry>> &out, uint64_t &endOffset) const;
+    void maybeSync();
+
+public:
+    explicit Leaderboard(const std::string &dir = defaultDirectory());
+    ~Leaderboard();
+
+    bool isOpen() const { return logFd >= 0; }
+
+    // 점수 기록 (로그 끝에 추가, fsync 는 모아서)
+    bool submit(int level, int score);
+
+    // 아직 디스크에 확정되지 않은 기록을 바로 fsync
+    void flush();
+
+    // 색인 다시 읽기 (tail 이 길면 먼저 compact)
+    void refresh();
+
+    // 로그 전체로 레벨별 색인을 다시 만듦
+    bool compact();
+
+    // 레벨 상위 k 개 (내림차순)
+    std::vector<ScoreEntry> topK(int level, int k) const;
+
+    // score 가 몇 등인지 (1부터, 같은 점수는 같은 등수)
+    int rankOf(int level, int score) const;
+
+    // 레벨에 기록된 점수 개수
+    int countOf(int level) const;
+
+    // 기본 저장 위치: SNOWMAN_SCORE_DIR, 없으면 $HOME/.snowman_scores, 그것도 없으면 ./snowman_scores
+    static std::string defaultDirectory();
+};
+
+#endif // LEADERBOARD_H
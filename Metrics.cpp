@@ -0,0 +1,77 @@
+#include "Metrics.h"
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+bool MetricsExporter::start(const char *path)
+{
+    return listener.start(path, SOCK_STREAM | SOCK_CLOEXEC, 16, [this]()
+                          { serve(); });
+}
+
+void MetricsExporter::stop()
+{
+    listener.stop();
+}
+
+void MetricsExporter::serve()
+{
+    while (!listener.isStopping())
+    {
+        pollfd waiting = {listener.getFd(), POLLIN, 0};
+        if (poll(&waiting, 1, UnixListener::POLL_MILLIS) <= 0)
+        {
+            continue;
+        }
+        int clientFd = accept4(listener.getFd(), nullptr, nullptr, SOCK_CLOEXEC);
+        if (clientFd < 0)
+        {
+            continue;
+        }
+        answer(clientFd);
+        close(clientFd);
+    }
+}
+
+void MetricsExporter::answer(int clientFd)
+{
+    // 느린 수집기가 내보내기 스레드를 오래 붙잡지 못하게 송신 제한 시간 설정
+    timeval limit = {1, 0};
+    setsockopt(clientFd, SOL_SOCKET, SO_SNDTIMEO, &limit, sizeof(limit));
+
+    // 요청 줄은 읽기만 하고 버림 (경로와 상관없이 항상 메트릭을 돌려줌)
+    pollfd request = {clientFd, POLLIN, 0};
+    if (poll(&request, 1, 100) > 0)
+    {
+        char discard[1024];
+        if (recv(clientFd, discard, sizeof(discard), MSG_DONTWAIT) < 0 && errno != EAGAIN)
+        {
+            return;
+        }
+    }
+
+    std::string body = MetricsRegistry::instance().exposition();
+    char header[128];
+    int headerLength = snprintf(header, sizeof(header),
+                                "HTTP/1.0 200 OK\r\n"
+                                "Content-Type: text/plain; version=0.0.4\r\n"
+                                "Content-Length: %zu\r\n\r\n",
+                                body.size());
+    std::string response(header, static_cast<size_t>(headerLength));
+    response += body;
+
+    size_t sent = 0;
+    while (sent < response.size())
+    {
+        ssize_t written = send(clientFd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (written <= 0)
+        {
+            return;
+        }
+        sent += static_cast<size_t>(written);
+    }
+    shutdown(clientFd, SHUT_WR);
+}
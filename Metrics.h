@@ -0,0 +1,350 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "UnixListener.h"
+
+// ===== 프로세스 단위 메트릭 레지스트리 =====
+// - 카운터/게이지/히스토그램은 스레드마다 다른 샤드(캐시 라인 하나)에 relaxed 원자 연산으로 더하고
+//   읽을 때만 샤드를 합친다 -> 게임 루프 쪽은 잠금도, 다른 스레드와의 캐시 라인 경합도 없음
+// - 등록(시작할 때 한 번)과 내보내기(scrape)만 레지스트리 잠금을 잡는다
+// - 내보내기 형식은 Prometheus text exposition (MetricsExporter 가 Unix 소켓으로 제공)
+
+class MetricsRegistry
+{
+public:
+    static const int SHARDS = 16;
+
+    // 현재 스레드가 쓸 샤드 번호 (스레드가 처음 쓸 때 돌아가며 배정)
+    static int shardIndex()
+    {
+        static std::atomic<int> nextShard(0);
+        static thread_local int shard = nextShard++ % SHARDS;
+        return shard;
+    }
+
+    class Counter
+    {
+    private:
+        struct alignas(64) Cell
+        {
+            std::atomic<uint64_t> value{0};
+        };
+        Cell cells[SHARDS];
+
+    public:
+        void add(uint64_t amount = 1) { cells[shardIndex()].value.fetch_add(amount, std::memory_order_relaxed); }
+
+        uint64_t value() const
+        {
+            uint64_t sum = 0;
+            for (const Cell &cell : cells)
+            {
+                sum += cell.value.load(std::memory_order_relaxed);
+            }
+            return sum;
+        }
+    };
+
+    // 여러 세션이 각자 증감분만 더하는 게이지 (합계가 현재 값)
+    class Gauge
+    {
+    private:
+        struct alignas(64) Cell
+        {
+            std::atomic<int64_t> value{0};
+        };
+        Cell cells[SHARDS];
+
+    public:
+        void add(int64_t delta) { cells[shardIndex()].value.fetch_add(delta, std::memory_order_relaxed); }
+
+        int64_t value() const
+        {
+            int64_t sum = 0;
+            for (const Cell &cell : cells)
+            {
+                sum += cell.value.load(std::memory_order_relaxed);
+            }
+            return sum;
+        }
+    };
+
+    // 시간 히스토그램 (나노초로 기록, 초 단위로 내보냄)
+    class Timing
+    {
+    public:
+        static const int BOUNDS = 18;
+
+        static uint64_t boundNanos(int i)
+        {
+            static const uint64_t bounds[BOUNDS] = {
+                1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000,
+                1000000, 2500000, 5000000, 10000000, 25000000, 50000000, 100000000, 250000000, 1000000000};
+            return bounds[i];
+        }
+
+    private:
+        struct alignas(64) Cell
+        {
+            std::atomic<uint64_t> buckets[BOUNDS + 1]; // 마지막은 +Inf
+            std::atomic<uint64_t> sumNanos;
+
+            Cell() : sumNanos(0)
+            {
+                for (auto &bucket : buckets)
+                {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+        Cell cells[SHARDS];
+
+    public:
+        void record(uint64_t nanos)
+        {
+            int bucket = 0;
+            while (bucket < BOUNDS && nanos > boundNanos(bucket))
+            {
+                bucket++;
+            }
+            Cell &cell = cells[shardIndex()];
+            cell.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            cell.sumNanos.fetch_add(nanos, std::memory_order_relaxed);
+        }
+
+        // 샤드를 합친 (누적 아님) 버킷 값과 합계
+        void snapshot(uint64_t (&buckets)[BOUNDS + 1], uint64_t &sumNanos) const
+        {
+            sumNanos = 0;
+            for (int i = 0; i <= BOUNDS; i++)
+            {
+                buckets[i] = 0;
+            }
+            for (const Cell &cell : cells)
+            {
+                for (int i = 0; i <= BOUNDS; i++)
+                {
+                    buckets[i] += cell.buckets[i].load(std::memory_order_relaxed);
+                }
+                sumNanos += cell.sumNanos.load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+private:
+    enum class Type
+    {
+        COUNTER,
+        GAUGE,
+        HISTOGRAM
+    };
+
+    struct Entry
+    {
+        std::string family; // 메트릭 이름
+        std::string labels; // 예: type="time_bonus" (없으면 빈 문자열)
+        std::string help;
+        Type type;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Timing> timing;
+    };
+
+    mutable std::mutex lock;
+    std::vector<std::unique_ptr<Entry>> entries;
+
+    MetricsRegistry() {}
+    MetricsRegistry(const MetricsRegistry &) = delete;
+    MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+    Entry &add(const std::string &family, const std::string &labels, const std::string &help, Type type)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        entries.emplace_back(new Entry());
+        Entry &entry = *entries.back();
+        entry.family = family;
+        entry.labels = labels;
+        entry.help = help;
+        entry.type = type;
+        return entry;
+    }
+
+    static void appendLine(std::string &out, const std::string &family, const char *suffix,
+                           const std::string &labels, const char *value)
+    {
+        out += family;
+        out += suffix;
+        if (!labels.empty())
+        {
+            out += '{';
+            out += labels;
+            out += '}';
+        }
+        out += ' ';
+        out += value;
+        out += '\n';
+    }
+
+public:
+    static MetricsRegistry &instance()
+    {
+        static MetricsRegistry registry;
+        return registry;
+    }
+
+    // 등록 (같은 이름을 라벨만 바꿔 여러 번 등록하면 한 묶음으로 내보냄)
+    Counter &counter(const std::string &family, const std::string &help, const std::string &labels = "")
+    {
+        Entry &entry = add(family, labels, help, Type::COUNTER);
+        entry.counter.reset(new Counter());
+        return *entry.counter;
+    }
+
+    Gauge &gauge(const std::string &family, const std::string &help, const std::string &labels = "")
+    {
+        Entry &entry = add(family, labels, help, Type::GAUGE);
+        entry.gauge.reset(new Gauge());
+        return *entry.gauge;
+    }
+
+    Timing &timing(const std::string &family, const std::string &help)
+    {
+        Entry &entry = add(family, "", help, Type::HISTOGRAM);
+        entry.timing.reset(new Timing());
+        return *entry.timing;
+    }
+
+    // Prometheus text 형식으로 현재 값 출력
+    std::string exposition() const
+    {
+        static const char *TYPE_NAMES[] = {"counter", "gauge", "histogram"};
+        std::string out;
+        char value[64];
+
+        std::lock_guard<std::mutex> guard(lock);
+        out.reserve(entries.size() * 160);
+        const std::string *previousFamily = nullptr;
+        for (const auto &item : entries)
+        {
+            const Entry &entry = *item;
+            if (!previousFamily || *previousFamily != entry.family)
+            {
+                out += "# HELP " + entry.family + " " + entry.help + "\n";
+                out += "# TYPE " + entry.family + " " + TYPE_NAMES[static_cast<int>(entry.type)] + "\n";
+                previousFamily = &entry.family;
+            }
+
+            switch (entry.type)
+            {
+            case Type::COUNTER:
+                snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(entry.counter->value()));
+                appendLine(out, entry.family, "", entry.labels, value);
+                break;
+            case Type::GAUGE:
+                snprintf(value, sizeof(value), "%lld", static_cast<long long>(entry.gauge->value()));
+                appendLine(out, entry.family, "", entry.labels, value);
+                break;
+            case Type::HISTOGRAM:
+            {
+                uint64_t buckets[Timing::BOUNDS + 1];
+                uint64_t sumNanos = 0;
+                entry.timing->snapshot(buckets, sumNanos);
+                uint64_t cumulative = 0;
+                for (int i = 0; i <= Timing::BOUNDS; i++)
+                {
+                    cumulative += buckets[i];
+                    char labels[32];
+                    if (i < Timing::BOUNDS)
+                        snprintf(labels, sizeof(labels), "le=\"%g\"", Timing::boundNanos(i) / 1e9);
+                    else
+                        snprintf(labels, sizeof(labels), "le=\"+Inf\"");
+                    snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(cumulative));
+                    appendLine(out, entry.family, "_bucket", labels, value);
+                }
+                snprintf(value, sizeof(value), "%.9f", sumNanos / 1e9);
+                appendLine(out, entry.family, "_sum", "", value);
+                snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(cumulative));
+                appendLine(out, entry.family, "_count", "", value);
+            }
+            break;
+            }
+        }
+        return out;
+    }
+};
+
+// 게임에서 쓰는 메트릭 모음 (처음 쓸 때 한 번 등록)
+struct GameMetrics
+{
+    MetricsRegistry::Counter &framesRendered;
+    MetricsRegistry::Timing &frameSeconds;
+    MetricsRegistry::Counter &ticks;
+    MetricsRegistry::Timing &tickSeconds;
+    MetricsRegistry::Gauge &sessionsActive;
+    MetricsRegistry::Gauge &entitiesAlive;
+    MetricsRegistry::Counter &keystrokes;
+    MetricsRegistry::Counter &timePenalties;
+    MetricsRegistry::Counter &timePenaltySeconds;
+    MetricsRegistry::Counter &itemTimeBonus;
+    MetricsRegistry::Counter &itemTimeMinus;
+    MetricsRegistry::Counter &itemScoreBoost;
+    MetricsRegistry::Counter &roundsCompleted;
+
+    static GameMetrics &get()
+    {
+        static GameMetrics metrics(MetricsRegistry::instance());
+        return metrics;
+    }
+
+private:
+    explicit GameMetrics(MetricsRegistry &r)
+        : framesRendered(r.counter("snowman_frames_rendered_total", "Frames drawn by the play screen.")),
+          frameSeconds(r.timing("snowman_frame_render_seconds", "Time spent drawing one play screen frame.")),
+          ticks(r.counter("snowman_ticks_total", "Game simulation ticks across all sessions.")),
+          tickSeconds(r.timing("snowman_tick_seconds", "Time spent in one GameSession::tick.")),
+          sessionsActive(r.gauge("snowman_sessions_active", "Game sessions currently alive.")),
+          entitiesAlive(r.gauge("snowman_entities_alive", "Falling word blocks and item boxes across all sessions.")),
+          keystrokes(r.counter("snowman_keystrokes_total", "Keys handled by game sessions.")),
+          timePenalties(r.counter("snowman_time_penalties_total", "Time penalties applied for words hitting the ground.")),
+          timePenaltySeconds(r.counter("snowman_time_penalty_seconds_total", "Seconds removed by time penalties.")),
+          itemTimeBonus(r.counter("snowman_item_effects_total", "Item box effects applied.", "type=\"time_bonus\"")),
+          itemTimeMinus(r.counter("snowman_item_effects_total", "Item box effects applied.", "type=\"time_minus\"")),
+          itemScoreBoost(r.counter("snowman_item_effects_total", "Item box effects applied.", "type=\"score_boost\"")),
+          roundsCompleted(r.counter("snowman_rounds_completed_total", "Snowmen completed (sentences solved)."))
+    {
+    }
+};
+
+// Prometheus text 를 Unix 도메인 소켓으로 내보내는 스레드 (Metrics.cpp)
+// 연결마다 HTTP/1.0 응답 하나를 돌려주고 닫는다: curl --unix-socket <path> http://localhost/metrics
+// 게임 루프와는 원자 변수 읽기로만 만나므로 느린 수집기가 게임을 막지 않는다.
+class MetricsExporter
+{
+private:
+    UnixListener listener;
+
+    MetricsExporter(const MetricsExporter &) = delete;
+    MetricsExporter &operator=(const MetricsExporter &) = delete;
+
+    void serve();
+    void answer(int clientFd);
+
+public:
+    MetricsExporter() {}
+    ~MetricsExporter() { stop(); }
+
+    // path 가 비어 있거나 nullptr 이면 아무것도 하지 않음
+    bool start(const char *path);
+    void stop();
+    bool isRunning() const { return listener.isRunning(); }
+};
+
+#endif // METRICS_H
@@ -0,0 +1,39 @@
+#ifndef PROBES_H
+#define PROBES_H
+
+// Linux 정적 추적 지점 (SDT / USDT, 공급자 이름 "snowman")
+// <sys/sdt.h> (systemtap-sdt-dev) 가 있으면 각 지점이 nop 한 개와 ELF 노트(.note.stapsdt)로 들어가고,
+// 추적기가 붙지 않았을 때는 그 nop 만 실행된다. 헤더가 없으면 아무 코드도 만들지 않는다.
+// 인자는 레지스터에 이미 있는 정수만 넘겨서 꺼져 있을 때 추가 계산이 없도록 한다.
+//
+// 지점 (모든 지점의 첫 인자는 세션 번호, GameSession::getId):
+//   tick_start(session, nowMillis)            tick_end(session, timersFired)
+//   word_blocks_advance(session, activeBlocks, reachedBottom)
+//   word_spawn(session, wordIndex, x)         time_penalty(session, seconds, remainingTime)
+//   item_use(session, itemType)               round_complete(session, collectedSnowmen, totalScore)
+//   key_read(session, key)                    frame_present(session, drawNanos)
+//
+// 예 (재빌드/재시작 없이 실행 중인 게임에 붙이기):
+//   bpftrace -p $(pidof mygame) -e 'usdt:./mygame:snowman:tick_start { @s[arg0] = nsecs; }
+//       usdt:./mygame:snowman:tick_end /@s[arg0]/ { @tick_ns = hist(nsecs - @s[arg0]); }'
+//   perf buildid-cache --add ./mygame && perf record -e sdt_snowman:key_read -p <pid>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SNOWMAN_HAS_PROBES 1
+#endif
+#endif
+
+#ifdef SNOWMAN_HAS_PROBES
+#define SNOWMAN_PROBE1(name, a) STAP_PROBE1(snowman, name, a)
+#define SNOWMAN_PROBE2(name, a, b) STAP_PROBE2(snowman, name, a, b)
+#define SNOWMAN_PROBE3(name, a, b, c) STAP_PROBE3(snowman, name, a, b, c)
+#else
+// 인자는 계산하지 않고 (sizeof) 쓰인 것으로만 표시 (추적 지점에만 쓰는 변수의 경고 방지)
+#define SNOWMAN_PROBE1(name, a) ((void)sizeof(a))
+#define SNOWMAN_PROBE2(name, a, b) ((void)sizeof(a), (void)sizeof(b))
+#define SNOWMAN_PROBE3(name, a, b, c) ((void)sizeof(a), (void)sizeof(b), (void)sizeof(c))
+#endif
+
+#endif // PROBES_H
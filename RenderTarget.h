@@ -0,0 +1,213 @@
+#ifndef RENDERTARGET_H
+#define RENDERTARGET_H
+
+#include <cstdarg>
+#include <memory>
+#include <ncurses.h>
+
+// RenderTarget: 화면 그리기 대상
+// PlayScreen / InitialScreen 은 stdscr 대신 이 인터페이스로만 그린다.
+// - CursesTarget: 실제 터미널 (ncurses stdscr 또는 창 하나)
+// - FrameBuffer: 메모리 안의 셀 배열 (터미널 없이 렌더링 측정/골든 프레임 비교, FrameBuffer.h)
+// 속성 값은 ncurses 와 같은 attr_t (COLOR_PAIR(n) | A_BOLD ...) 를 그대로 쓴다.
+//
+// 화면 일부만 자주 바뀌는 경우 openWindow() 로 영역별 창을 만들어 바뀐 창만 다시 그리고
+// stage() 로 올려 둔 뒤, 프레임마다 한 번 flush() 로 터미널에 내보낸다 (wnoutrefresh / doupdate).
+class RenderTarget
+{
+public:
+    virtual ~RenderTarget() {}
+
+    virtual int getHeight() const = 0;
+    virtual int getWidth() const = 0;
+
+    // 전체 지우기 (화면: clear, 창: werase)
+    virtual void clear() = 0;
+
+    // (y, x) 부터 그 줄 끝까지 지우기 (wclrtoeol)
+    virtual void clearToEndOfLine(int y, int x) = 0;
+
+    // 현재 속성 켜기/끄기 (attron / attroff 와 같은 규칙)
+    virtual void attrOn(attr_t attrs) = 0;
+    virtual void attrOff(attr_t attrs) = 0;
+
+    // (y, x) 부터 printf 형식으로 쓰기 (mvprintw), 창이면 창 안 좌표
+    virtual void vprint(int y, int x, const char *format, va_list args) = 0;
+
+    // (y, x) 부터 속성이 들어 있는 글자(chtype) count 개를 그대로 쓰기 (mvwaddchnstr)
+    // 현재 속성은 쓰지 않고, 커서도 움직이지 않으며, 줄 끝을 넘는 부분은 버림 (Sprite.h)
+    virtual void putCells(int y, int x, const chtype *cells, int count) = 0;
+
+    // 바로 내보내기 (refresh)
+    virtual void present() = 0;
+
+    // 내보낼 내용으로 올려 두기만 함 (wnoutrefresh)
+    virtual void stage() = 0;
+
+    // 올려 둔 내용을 한 번에 내보내기 (doupdate)
+    virtual void flush() = 0;
+
+    // (top, left) 에서 시작하는 rows x cols 창 (이 대상보다 오래 쓰면 안 됨)
+    virtual std::unique_ptr<RenderTarget> openWindow(int rows, int cols, int top, int left) = 0;
+
+    void print(int y, int x, const char *format, ...) __attribute__((format(printf, 4, 5)))
+    {
+        va_list args;
+        va_start(args, format);
+        vprint(y, x, format, args);
+        va_end(args);
+    }
+};
+
+// 실제 터미널 (initscr 는 화면 쪽에서 이미 호출했다고 가정)
+class CursesTarget : public RenderTarget
+{
+private:
+    WINDOW *window; // nullptr 이면 stdscr (endwin/initscr 뒤에도 그때의 stdscr 을 씀)
+
+    CursesTarget(const CursesTarget &) = delete;
+    CursesTarget &operator=(const CursesTarget &) = delete;
+
+    WINDOW *win() const { return window ? window : stdscr; }
+
+public:
+    CursesTarget() : window(nullptr) {}
+    explicit CursesTarget(WINDOW *ownedWindow) : window(ownedWindow) {}
+    ~CursesTarget()
+    {
+        if (window)
+        {
+            delwin(window);
+        }
+    }
+
+    int getHeight() const override { return getmaxy(win()); }
+    int getWidth() const override { return getmaxx(win()); }
+
+    void clear() override
+    {
+        // 창에서 wclear 를 쓰면 다음 갱신 때 터미널 전체를 다시 그리므로 werase
+        if (window)
+            werase(window);
+        else
+            ::clear();
+    }
+
+    void clearToEndOfLine(int y, int x) override
+    {
+        if (wmove(win(), y, x) != ERR)
+        {
+            wclrtoeol(win());
+        }
+    }
+
+    void attrOn(attr_t attrs) override { wattron(win(), attrs); }
+    void attrOff(attr_t attrs) override { wattroff(win(), attrs); }
+
+    void vprint(int y, int x, const char *format, va_list args) override
+    {
+        if (wmove(win(), y, x) != ERR)
+        {
+            vw_printw(win(), format, args);
+        }
+    }
+
+    void putCells(int y, int x, const chtype *cells, int count) override
+    {
+        mvwaddchnstr(win(), y, x, cells, count);
+    }
+
+    void present() override { wrefresh(win()); }
+    void stage() override { wnoutrefresh(win()); }
+    void flush() override { doupdate(); }
+
+    std::unique_ptr<RenderTarget> openWindow(int rows, int cols, int top, int left) override
+    {
+        int originY = window ? getbegy(window) : 0;
+        int originX = window ? getbegx(window) : 0;
+        WINDOW *created = newwin(rows, cols, originY + top, originX + left);
+        if (!created)
+        {
+            return nullptr;
+        }
+        return std::unique_ptr<RenderTarget>(new CursesTarget(created));
+    }
+};
+
+// TeeTarget: 두 대상에 똑같이 그리기 (터미널 + FrameBuffer: 관전 중계, 실제 ncurses 결과와 비교하는 테스트)
+class TeeTarget : public RenderTarget
+{
+private:
+    std::unique_ptr<RenderTarget> ownedFirst; // 창을 나눠 만든 경우
+    std::unique_ptr<RenderTarget> ownedSecond;
+    RenderTarget &first;
+    RenderTarget &second;
+
+public:
+    TeeTarget(RenderTarget &a, RenderTarget &b) : first(a), second(b) {}
+    TeeTarget(std::unique_ptr<RenderTarget> a, std::unique_ptr<RenderTarget> b)
+        : ownedFirst(std::move(a)), ownedSecond(std::move(b)), first(*ownedFirst), second(*ownedSecond) {}
+
+    int getHeight() const override { return first.getHeight(); }
+    int getWidth() const override { return first.getWidth(); }
+    void clear() override
+    {
+        first.clear();
+        second.clear();
+    }
+    void clearToEndOfLine(int y, int x) override
+    {
+        first.clearToEndOfLine(y, x);
+        second.clearToEndOfLine(y, x);
+    }
+    void attrOn(attr_t attrs) override
+    {
+        first.attrOn(attrs);
+        second.attrOn(attrs);
+    }
+    void attrOff(attr_t attrs) override
+    {
+        first.attrOff(attrs);
+        second.attrOff(attrs);
+    }
+    void vprint(int y, int x, const char *format, va_list args) override
+    {
+        va_list copy;
+        va_copy(copy, args);
+        first.vprint(y, x, format, args);
+        second.vprint(y, x, format, copy);
+        va_end(copy);
+    }
+    void putCells(int y, int x, const chtype *cells, int count) override
+    {
+        first.putCells(y, x, cells, count);
+        second.putCells(y, x, cells, count);
+    }
+    void present() override
+    {
+        first.present();
+        second.present();
+    }
+    void stage() override
+    {
+        first.stage();
+        second.stage();
+    }
+    void flush() override
+    {
+        first.flush();
+        second.flush();
+    }
+    std::unique_ptr<RenderTarget> openWindow(int rows, int cols, int top, int left) override
+    {
+        std::unique_ptr<RenderTarget> a = first.openWindow(rows, cols, top, left);
+        std::unique_ptr<RenderTarget> b = second.openWindow(rows, cols, top, left);
+        if (!a || !b)
+        {
+            return nullptr;
+        }
+        return std::unique_ptr<RenderTarget>(new TeeTarget(std::move(a), std::move(b)));
+    }
+};
+
+#endif // RENDERTARGET_H
@@ -0,0 +1,55 @@
+#ifndef ROUNDARENA_H
+#define ROUNDARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// RoundArena: 한 라운드(문장 하나) 동안만 쓰는 데이터를 담는 단조 증가 메모리
+// - 목표 단어, 블록 목록, 생성 순서 등을 포인터만 밀면서 할당하고 개별 해제는 하지 않음
+// - 라운드가 끝나면 release() 한 번으로 전부 버림 (내장 버퍼로 되돌아갈 뿐이라 O(1))
+// - 내장 버퍼를 넘친 경우에만 힙을 쓰고, 그 양은 getOverflowBytes() 로 확인
+class RoundArena
+{
+public:
+    static const size_t INLINE_BYTES = 16 * 1024;
+
+private:
+    // 넘친 양을 세면서 힙으로 넘겨주는 상위 리소스
+    class OverflowResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t bytes = 0;
+
+    private:
+        void *do_allocate(size_t size, size_t alignment) override
+        {
+            bytes += size;
+            return std::pmr::new_delete_resource()->allocate(size, alignment);
+        }
+        void do_deallocate(void *p, size_t size, size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+    };
+
+    alignas(std::max_align_t) unsigned char buffer[INLINE_BYTES];
+    OverflowResource overflow;
+    std::pmr::monotonic_buffer_resource resource;
+
+    RoundArena(const RoundArena &) = delete;
+    RoundArena &operator=(const RoundArena &) = delete;
+
+public:
+    RoundArena() : resource(buffer, sizeof(buffer), &overflow) {}
+
+    std::pmr::memory_resource *getResource() { return &resource; }
+
+    // 라운드 데이터 전체 해제 (이 메모리를 쓰던 객체는 먼저 소멸시켜 둘 것)
+    void release() { resource.release(); }
+
+    // 지금까지 내장 버퍼를 넘쳐 힙에서 가져온 총량
+    size_t getOverflowBytes() const { return overflow.bytes; }
+};
+
+#endif // ROUNDARENA_H
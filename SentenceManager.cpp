@@ -1,8 +1,12 @@
 #include "SentenceManager.h"
 #include <algorithm>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
+#include <new>
 #include "WordBlock.h"
 #include "ItemBox.h"
+#include "StringUtil.h"
 
 // ========== InputHandler 구현 ==========
 bool InputHandler::handleInput(int key)
@@ -87,21 +91,15 @@ int InputHandler::getCompletedInputsCount() const
 }
 
 // 추가: 개별 단어 정확도 체크
-bool InputHandler::isWordCorrect(int index, const std::string &target) const
+bool InputHandler::isWordCorrect(int index, std::string_view target) const
 {
     if (index < 0 || index >= static_cast<int>(userInputs.size()))
     {
         return false;
     }
 
-    std::string userWord = userInputs[index];
-    std::string targetWord = target;
-
     // 대소문자 구분 없이 비교
-    std::transform(userWord.begin(), userWord.end(), userWord.begin(), ::tolower);
-    std::transform(targetWord.begin(), targetWord.end(), targetWord.begin(), ::tolower);
-
-    return userWord == targetWord;
+    return equalsIgnoreCase(userInputs[index], target);
 }
 
 // 추가: 특정 입력 필드 초기화
@@ -114,13 +112,14 @@ void InputHandler::clearInput(int index)
 }
 
 // 추가: 특정 입력 필드 값 반환
-std::string InputHandler::getInputAt(int index) const
+const std::string &InputHandler::getInputAt(int index) const
 {
+    static const std::string empty;
     if (index >= 0 && index < static_cast<int>(userInputs.size()))
     {
         return userInputs[index];
     }
-    return "";
+    return empty;
 }
 
 // ========== SentenceManager 구현 (수정됨) ==========
@@ -130,57 +129,155 @@ std::string InputHandler::getInputAt(int index) const
 // 삭제: initializeTargetWords() 함수 제거
 // 이유: Dictionary에서 동적으로 로드하므로 하드코딩된 단어 배열 불필요
 
-// 새로 추가: 특정 레벨의 특정 문장 로드
-void SentenceManager::loadSentenceForLevel(int level, int sentenceIndex)
+// 라운드 데이터 해제 (아레나는 포인터만 되돌림)
+void SentenceManager::endRound()
+{
+    if (round)
+    {
+        round->~RoundData();
+        round = nullptr;
+    }
+    roundArenas[activeArena].release();
+}
+
+void SentenceManager::discardStagedRound()
+{
+    if (stagedRound)
+    {
+        stagedRound->~RoundData();
+        stagedRound = nullptr;
+    }
+    roundArenas[1 - activeArena].release();
+}
+
+RoundData *SentenceManager::buildRound(RoundArena &arena, int level, int sentenceIndex)
 {
-    // 레벨 유효성 검사
-    if (level < 1 || level > 3)
+    std::pmr::memory_resource *resource = arena.getResource();
+    RoundData *data = new (resource->allocate(sizeof(RoundData), alignof(RoundData))) RoundData(resource);
+    data->targetWords.reserve(Dictionary::WORDS_PER_SENTENCE * 2);
+    data->wordBlocks.reserve(WORD_BLOCK_CAPACITY);
+
+    // 문장 원문을 단어로 나눠 아레나에 둠
+    // (Dictionary::splitSentenceIntoWords 와 같은 규칙: 공백으로 나누고 . , ! ? 제거)
+    // mmap 한 코퍼스라면 여기서 문장 페이지를 읽게 되므로, 미리 준비하면 라운드 시작 때 페이지 폴트가 없음
+    std::string_view sentence = dictionary->selectSentence(level, sentenceIndex);
+    data->level = dictionary->getCurrentLevel();
+    data->sentenceIndex = dictionary->getCurrentSentenceIndex();
+    data->tokens.reserve(sentence.size(), Dictionary::WORDS_PER_SENTENCE * 2);
+    data->tokens.tokenize(sentence);
+    for (size_t i = 0; i < data->tokens.size(); i++)
     {
-        level = 1; // 기본값
+        data->targetWords.push_back(data->tokens[i]);
     }
 
-    // 문장 인덱스 유효성 검사
-    int sentenceCount = dictionary->getSentenceCount(level);
-    if (sentenceIndex < 0 || sentenceIndex >= sentenceCount)
+    data->spawnedAt.assign(data->targetWords.size(), 0);
+    data->matcher.setWords(data->targetWords);
+
+    // 단어 블록 생성 순서 (Fisher-Yates)
+    data->spawnOrder.resize(Dictionary::WORDS_PER_SENTENCE);
+    for (int i = 0; i < Dictionary::WORDS_PER_SENTENCE; i++)
     {
-        sentenceIndex = 0; // 기본값
+        data->spawnOrder[i] = i;
+    }
+    for (int i = Dictionary::WORDS_PER_SENTENCE - 1; i > 0; i--)
+    {
+        int j = randomBelow(random, i + 1);
+        std::swap(data->spawnOrder[i], data->spawnOrder[j]);
     }
 
-    // Dictionary에서 단어 가져오기
-    targetWords = dictionary->getWordsForLevel(level, sentenceIndex);
+    // 게임 영역 폭을 이미 알면 첫 바퀴 블록 위치도 미리 정함 (createWordBlock 과 같은 범위)
+    if (wordAreaWidth > 0)
+    {
+        int minX = 2;
+        int maxX = wordAreaWidth - 15;
+        data->spawnWidth = wordAreaWidth;
+        data->spawnX.resize(Dictionary::WORDS_PER_SENTENCE);
+        for (int i = 0; i < Dictionary::WORDS_PER_SENTENCE; i++)
+        {
+            data->spawnX[i] = minX + randomBelow(random, maxX - minX);
+        }
+    }
+    return data;
+}
 
-    // 현재 상태 업데이트
-    currentLevel = level;
-    currentSentenceIndex = sentenceIndex;
+void SentenceManager::startRound(RoundData *next)
+{
+    round = next;
+    round->stats.startedAt = GameClock::now();
+    currentLevel = round->level;
+    currentSentenceIndex = round->sentenceIndex;
 
     // 입력 초기화
     inputHandler->resetInputs();
     correctMatches = 0;
+    nearMatches = 0;
+    hintWord = -1;
 }
 
-// 새로 추가: 랜덤 문장 로드 (게임 시작 시 사용)
-void SentenceManager::loadRandomSentence(int level)
+void SentenceManager::beginRound(int level, int sentenceIndex)
+{
+    discardStagedRound();
+    endRound();
+    startRound(buildRound(roundArenas[activeArena], level, sentenceIndex));
+}
+
+void SentenceManager::stageNextRound(int level)
 {
-    if (level < 1 || level > 3)
+    if (stagedRound)
+    {
+        return;
+    }
+    if (level < 1 || level > Dictionary::LEVEL_COUNT)
     {
         level = 1;
     }
 
-    // Dictionary의 랜덤 문장 선택 기능 사용
-    targetWords = dictionary->getRandomSentenceWords(level);
+    // 지난번 교체 때 남겨 둔 이전 라운드 아레나를 여기서 비움 (교체하는 프레임에서는 해제도 하지 않음)
+    discardStagedRound();
+    stagedRound = buildRound(roundArenas[1 - activeArena], level, dictionary->pickRandomSentence(level));
+}
 
-    currentLevel = level;
-    currentSentenceIndex = dictionary->getCurrentSentenceIndex();
+// 새로 추가: 특정 레벨의 특정 문장 로드
+void SentenceManager::loadSentenceForLevel(int level, int sentenceIndex)
+{
+    // 레벨/문장 인덱스 검증은 Dictionary::selectSentence 에서
+    beginRound(level, sentenceIndex);
+}
 
-    inputHandler->resetInputs();
-    correctMatches = 0;
+// 새로 추가: 랜덤 문장 로드 (게임 시작 시, 라운드마다 사용)
+void SentenceManager::loadRandomSentence(int level)
+{
+    if (level < 1 || level > Dictionary::LEVEL_COUNT)
+    {
+        level = 1;
+    }
+
+    // 미리 만들어 둔 다음 라운드가 있으면 포인터만 바꿈 (이전 라운드 아레나는 다음 준비 때 비움)
+    if (stagedRound && stagedRound->level == level)
+    {
+        RoundData *previous = round;
+        RoundData *next = stagedRound;
+        stagedRound = nullptr;
+        activeArena = 1 - activeArena;
+        if (previous)
+        {
+            previous->~RoundData();
+        }
+        startRound(next);
+        return;
+    }
+
+    // Dictionary의 중복 없는 랜덤 문장 선택 기능 사용
+    beginRound(level, dictionary->pickRandomSentence(level));
 }
 
-// 수정: 답안 체크 로직 강화
+// 수정: 답안 체크 로직 강화 (오타 허용 범위 안이면 맞힌 것으로, 점수는 nearMatches 만큼 덜 받음)
 void SentenceManager::checkAnswers()
 {
     correctMatches = 0;
+    nearMatches = 0;
     const auto &userInputs = inputHandler->getUserInputs();
+    const auto &targetWords = round->targetWords;
 
     // targetWords와 userInputs 개수가 다르면 경고
     if (userInputs.size() != targetWords.size())
@@ -190,31 +287,68 @@ void SentenceManager::checkAnswers()
 
     for (size_t i = 0; i < userInputs.size() && i < targetWords.size(); i++)
     {
-        std::string userWord = userInputs[i];
-        std::string targetWord = targetWords[i];
-
         // 대소문자 구분 없이 비교
-        std::transform(userWord.begin(), userWord.end(), userWord.begin(), ::tolower);
-        std::transform(targetWord.begin(), targetWord.end(), targetWord.begin(), ::tolower);
-
-        if (userWord == targetWord)
+        if (equalsIgnoreCase(userInputs[i], targetWords[i]))
         {
             correctMatches++;
         }
+        else if (!userInputs[i].empty() && allowedTypos(targetWords[i]) > 0 &&
+                 round->matcher.distance(static_cast<int>(i), userInputs[i]) <= allowedTypos(targetWords[i]))
+        {
+            correctMatches++;
+            nearMatches++;
+        }
+    }
+}
+
+void SentenceManager::updateHint()
+{
+    hintWord = -1;
+    int slot = inputHandler->getCurrentInputIndex();
+    const std::string &input = inputHandler->getInputAt(slot);
+    if (input.empty())
+    {
+        return;
+    }
+
+    // 모든 단어와의 거리 (앞 입력에 글자만 붙었으면 붙은 글자만 계산)
+    const int *distances = round->matcher.distances(input);
+    int count = round->matcher.getWordCount();
+    for (int word = 0; word < count; word++)
+    {
+        // 아직 화면에 나온 적 없는 단어는 알려 주지 않음
+        if (round->spawnedAt[word] == 0)
+        {
+            continue;
+        }
+        // 같은 거리면 지금 칸의 단어
+        if (hintWord < 0 || distances[word] < hintDistance || (distances[word] == hintDistance && word == slot))
+        {
+            hintWord = word;
+            hintDistance = distances[word];
+        }
+    }
+
+    // 이미 정확히 친 경우와, 단어 절반 이상이 다른 경우는 힌트 없음
+    if (hintWord >= 0 && (hintDistance == 0 || hintDistance * 2 > static_cast<int>(round->targetWords[hintWord].size())))
+    {
+        hintWord = -1;
     }
 }
 
 void SentenceManager::advanceWordBlocks(int maxHeight)
 {
     bool hasReachedBottom = false;
+    int activeBlocks = 0;
 
     // 기존 블록들 이동 처리
-    for (auto &block : wordBlocks)
+    for (auto &block : round->wordBlocks)
     {
         if (!block.active)
         {
             continue;
         }
+        activeBlocks++;
 
         // FallingObject의 fall() 함수 호출 - 매 프레임마다 한 칸씩 내려감
         block.fall();
@@ -227,6 +361,7 @@ void SentenceManager::advanceWordBlocks(int maxHeight)
         {
             block.active = false;
             hasReachedBottom = true;
+            round->stats.wordsMissed++;
         }
     }
 
@@ -235,6 +370,7 @@ void SentenceManager::advanceWordBlocks(int maxHeight)
     {
         timePanalty = true;
     }
+    SNOWMAN_PROBE3(word_blocks_advance, sessionId, activeBlocks, hasReachedBottom ? 1 : 0);
 }
 
 void SentenceManager::advanceItemBoxes(int maxHeight)
@@ -265,6 +401,9 @@ void SentenceManager::createWordBlock(int maxWidth, int wordIndex)
 {
     wordAreaWidth = maxWidth;
 
+    auto &targetWords = round->targetWords;
+    auto &wordBlocks = round->wordBlocks;
+
     // wordIndex가 유효한 범위인지 확인
     if (wordIndex < 0 || wordIndex >= static_cast<int>(targetWords.size()))
     {
@@ -274,39 +413,43 @@ void SentenceManager::createWordBlock(int maxWidth, int wordIndex)
     int minX = 2;
     int maxX = wordAreaWidth - 15; // 단어 길이를 더 여유롭게 고려
 
-    const std::string &word = targetWords[wordIndex];
+    std::string_view word = targetWords[wordIndex];
+
+    // 바닥에 닿아 꺼진 블록은 다시 쓰이지 않으므로 비워서 용량 안에서 재사용
+    wordBlocks.erase(std::remove_if(wordBlocks.begin(), wordBlocks.end(), [](const WordBlock &b)
+                                    { return !b.active && !b.getIsInInput(); }),
+                     wordBlocks.end());
 
     // FallingObject를 상속받은 WordBlock 생성
-    WordBlock block(word, wordIndex, wordAreaWidth, 45, 1.0);
+    WordBlock block(word, wordIndex, wordAreaWidth, 45, random, 1.0);
 
-    // 랜덤 x 위치 설정
-    int randomX = minX + (std::rand() % std::max(1, maxX - minX));
+    // 랜덤 x 위치 설정 (라운드를 미리 준비하면서 정해 둔 첫 바퀴 위치가 있으면 그것 사용)
+    int spawned = round->stats.wordsSpawned;
+    int randomX = (spawned < static_cast<int>(round->spawnX.size()) && round->spawnWidth == wordAreaWidth)
+                      ? round->spawnX[spawned]
+                      : minX + randomBelow(random, maxX - minX);
     block.setPosition(randomX, 3); // 게임 영역 상단에서 시작
     block.active = true;
 
     block.syncProperties();
 
     wordBlocks.push_back(block);
+    round->stats.wordsSpawned++;
+    if (round->spawnedAt[wordIndex] == 0)
+    {
+        round->spawnedAt[wordIndex] = GameClock::nowMillis();
+    }
+    SNOWMAN_PROBE3(word_spawn, sessionId, wordIndex, randomX);
 }
 
 void SentenceManager::createItemBox(int maxWidth, int maxHeight)
 {
-    ItemBox box(maxWidth, maxHeight);
-    box.setPosition(rand() % (maxWidth - 4) + 1, 3);
+    ItemBox box(maxWidth, maxHeight, random);
+    box.setPosition(randomBelow(random, maxWidth - 4) + 1, 3);
     box.setActive(true);
     itemBoxes.push_back(box);
 }
 
-void SentenceManager::spawnItemBoxIfNeeded(int maxWidth, int maxHeight)
-{
-    time_t now = time(nullptr);
-    if (difftime(now, lastItemBoxSpawnTime) >= ITEMBOX_INTERVAL)
-    {
-        createItemBox(maxWidth, maxHeight);
-        lastItemBoxSpawnTime = now;
-    }
-}
-
 bool SentenceManager::tryUseActiveItemBox(ItemBox::ItemType &typeOut)
 {
     for (auto &box : itemBoxes)
@@ -314,6 +457,7 @@ bool SentenceManager::tryUseActiveItemBox(ItemBox::ItemType &typeOut)
         if (box.getIsActive())
         {
             typeOut = box.applyRandomEffect();
+            SNOWMAN_PROBE2(item_use, sessionId, static_cast<int>(typeOut));
             itemBoxes.erase(std::remove_if(itemBoxes.begin(), itemBoxes.end(), [](const ItemBox &b)
                                            { return !b.getIsActive(); }),
                             itemBoxes.end());
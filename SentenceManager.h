@@ -2,12 +2,21 @@
 #define SENTENCEMANAGER_H
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory_resource>
 #include <ctime>
 #include <ncurses.h>
 #include "Dictionary.h"
 #include "WordBlock.h"
 #include "ItemBox.h"
+#include "GameClock.h"
+#include "GameTuning.h"
+#include "RoundArena.h"
+#include "Probes.h"
+#include "FuzzyMatch.h"
+#include "Tokenizer.h"
+#include "GameRandom.h"
 
 // WordBlock 구조체/클래스 정의 제거 (WordBlock.h에서 정의되므로)
 
@@ -25,6 +34,11 @@ public:
     InputHandler() : currentInputIndex(0), inputComplete(false)
     {
         userInputs.resize(MAX_INPUTS, "");
+        // 입력 칸 용량을 미리 잡아 두면 타이핑 중에는 다시 할당하지 않음
+        for (auto &input : userInputs)
+        {
+            input.reserve(MAX_INPUT_LENGTH);
+        }
     }
 
     bool handleInput(int key);
@@ -43,40 +57,104 @@ public:
     int getCompletedInputsCount() const;
 
     // 추가: 개별 입력 필드 조작 메서드
-    bool isWordCorrect(int index, const std::string &target) const;
+    bool isWordCorrect(int index, std::string_view target) const;
     void clearInput(int index);
-    std::string getInputAt(int index) const;
+    const std::string &getInputAt(int index) const;
+};
+
+// 라운드 통계 (라운드가 바뀌면 새로 시작)
+struct RoundStats
+{
+    int wordsSpawned = 0; // 떨어뜨린 단어 블록 수
+    int wordsMissed = 0;  // 바닥에 닿은 단어 블록 수
+    time_t startedAt = 0;
+};
+
+// 한 라운드(문장 하나) 동안만 쓰는 데이터. 전부 RoundArena 에 할당되고 라운드가 끝나면 한꺼번에 버려짐
+struct RoundData
+{
+    int level;
+    int sentenceIndex;
+    TokenTable tokens;                              // 문장을 나눈 단어 (글자도 아레나에)
+    std::pmr::vector<std::string_view> targetWords; // tokens 의 단어를 가리킴
+    std::pmr::vector<WordBlock> wordBlocks;
+    std::pmr::vector<int> spawnOrder; // 단어 블록을 만들 순서 (랜덤)
+    std::pmr::vector<int> spawnX;     // 생성 순서대로 첫 바퀴 블록의 x 위치 (미리 정해 둔 경우, spawnWidth 기준)
+    std::pmr::vector<int64_t> spawnedAt; // 단어별로 블록이 처음 생긴 시각 (GameClock 밀리초, 아직이면 0)
+    int spawnWidth;
+    FuzzyMatcher matcher; // targetWords 와의 편집 거리 (오타 인정, 가장 가까운 단어 힌트)
+    RoundStats stats;
+
+    explicit RoundData(std::pmr::memory_resource *resource)
+        : level(1), sentenceIndex(0), tokens(resource), targetWords(resource), wordBlocks(resource), spawnOrder(resource),
+          spawnX(resource), spawnedAt(resource), spawnWidth(0), matcher(resource) {}
 };
 
 class SentenceManager
 {
 private:
     InputHandler *inputHandler;
+    GameRandom &random; // 게임 세션의 난수 (문장 선택, 생성 순서, 블록/상자 위치)
     Dictionary *dictionary;
-    std::vector<std::string> targetWords;
+    // 라운드 아레나 두 개: 하나는 지금 라운드, 다른 하나는 눈사람 완성 연출 동안 미리 만들어 두는 다음 라운드
+    RoundArena roundArenas[2];
+    int activeArena;       // round 가 들어 있는 아레나
+    RoundData *round;      // roundArenas[activeArena] 안에 있음
+    RoundData *stagedRound; // roundArenas[1 - activeArena] 안에 있음 (없으면 nullptr)
     int correctMatches;
-    std::vector<WordBlock> wordBlocks;
+    int nearMatches;     // correctMatches 중 오타를 인정한 칸 수
+    int typoTolerance;   // GameTuning::typoTolerance
+    int hintWord;        // 지금 칸 입력과 가장 가까운 단어 (없으면 -1)
+    int hintDistance;
     int wordAreaWidth;
     int currentLevel;
     int currentSentenceIndex;
+    int sessionId; // 추적 지점(Probes.h)에 넘기는 세션 번호
 
     bool timePanalty;
 
     std::vector<ItemBox> itemBoxes;
-    time_t lastItemBoxSpawnTime;
-    static constexpr double ITEMBOX_INTERVAL = 30.0;
+    double itemBoxInterval; // 아이템 박스 생성 간격 (GameTuning::itemBoxInterval)
+
+    // 게임 중 블록/박스 벡터가 다시 할당되지 않도록 미리 잡아 두는 용량
+    static const int WORD_BLOCK_CAPACITY = 64;
+    static const int ITEM_BOX_CAPACITY = 16;
+
+    // 문장 하나로 라운드 데이터를 아레나에 만듦 (문장 선택, 단어 분리, 생성 순서/위치까지)
+    RoundData *buildRound(RoundArena &arena, int level, int sentenceIndex);
+
+    // 이전 라운드 데이터를 버리고 새 라운드 데이터를 만들어 바로 시작
+    void beginRound(int level, int sentenceIndex);
+    void endRound();
+    void discardStagedRound();
+
+    // 만들어 둔 라운드로 교체 (포인터와 아레나 번호만 바꿈)
+    void startRound(RoundData *next);
+
+    // 단어 길이에 따라 인정하는 오타 수 (4글자 미만은 정확히, 8글자부터 최대 2)
+    int allowedTypos(std::string_view word) const
+    {
+        int byLength = static_cast<int>(word.size()) / 4;
+        return typoTolerance < byLength ? typoTolerance : byLength;
+    }
 
 public:
-    SentenceManager(int level) : correctMatches(0), currentLevel(level),
-                                 currentSentenceIndex(0), wordAreaWidth(0)
+    SentenceManager(int level, GameRandom &sessionRandom) : SentenceManager(level, GameTuning::forLevel(level), sessionRandom) {}
+
+    SentenceManager(int level, const GameTuning &tuning, GameRandom &sessionRandom)
+        : random(sessionRandom), activeArena(0), round(nullptr), stagedRound(nullptr), correctMatches(0), nearMatches(0),
+          typoTolerance(tuning.typoTolerance), hintWord(-1), hintDistance(0), wordAreaWidth(0), currentLevel(level),
+          currentSentenceIndex(0), sessionId(0), itemBoxInterval(tuning.itemBoxInterval)
     {
         inputHandler = new InputHandler();
-        dictionary = new Dictionary();
+        dictionary = new Dictionary(random);
+        itemBoxes.reserve(ITEM_BOX_CAPACITY);
         loadRandomSentence(level);
-        lastItemBoxSpawnTime = time(nullptr);
     }
     ~SentenceManager()
     {
+        discardStagedRound();
+        endRound();
         delete inputHandler;
         delete dictionary; // 추가: Dictionary 메모리 해제
     }
@@ -84,31 +162,54 @@ public:
     // 수정: initializeTargetWords() 삭제, 대신 loadSentenceForLevel() 사용
     void loadSentenceForLevel(int level, int sentenceIndex);
 
-    // 추가: 랜덤 문장 로드
+    // 추가: 랜덤 문장 로드 (다음 라운드를 미리 만들어 두었으면 그것으로 교체)
     void loadRandomSentence(int level);
 
+    // 다음 라운드를 미리 준비 (문장 선택, 단어 분리, 생성 순서와 위치 계산, mmap 코퍼스 페이지 읽기)
+    // 눈사람 완성 직후 호출하면 완성 연출이 끝날 때 loadRandomSentence 는 포인터 교체만 한다.
+    void stageNextRound(int level);
+    bool hasStagedRound() const { return stagedRound != nullptr; }
+
     void checkAnswers();
+    // 지금 입력칸 내용과 가장 가까운, 이미 떨어지기 시작한 단어를 찾아 둠 (키 입력 묶음마다)
+    void updateHint();
     void createWordBlock(int maxWidth, int wordIndex);
     void createItemBox(int maxWidth, int maxHeight);
     void advanceItemBoxes(int maxHeight);
-    void spawnItemBoxIfNeeded(int maxWidth, int maxHeight);
     bool tryUseActiveItemBox(ItemBox::ItemType &typeOut);
     void advanceWordBlocks(int maxHeight);
     // WordBlocks getter (const와 non-const 버전 모두 제공)
-    const std::vector<WordBlock> &getWordBlocks() const { return wordBlocks; }
-    std::vector<WordBlock> &getWordBlocks() { return wordBlocks; }
+    const std::pmr::vector<WordBlock> &getWordBlocks() const { return round->wordBlocks; }
+    std::pmr::vector<WordBlock> &getWordBlocks() { return round->wordBlocks; }
     const std::vector<ItemBox> &getItemBoxes() const { return itemBoxes; }
     std::vector<ItemBox> &getItemBoxes() { return itemBoxes; }
+    double getItemBoxInterval() const { return itemBoxInterval; }
 
     int getScore() const { return correctMatches * 100; }
 
     InputHandler *getInputHandler() const { return inputHandler; }
-    const std::vector<std::string> &getTargetWords() const { return targetWords; }
+    const std::pmr::vector<std::string_view> &getTargetWords() const { return round->targetWords; }
+    int64_t getWordSpawnMillis(int wordIndex) const
+    {
+        return wordIndex >= 0 && wordIndex < static_cast<int>(round->spawnedAt.size()) ? round->spawnedAt[wordIndex] : 0;
+    }
+
+    // 이번 라운드의 단어 블록 생성 순서와 통계
+    const std::pmr::vector<int> &getSpawnOrder() const { return round->spawnOrder; }
+    const RoundStats &getRoundStats() const { return round->stats; }
+    const RoundArena &getRoundArena() const { return roundArenas[activeArena]; }
+    size_t getRoundOverflowBytes() const { return roundArenas[0].getOverflowBytes() + roundArenas[1].getOverflowBytes(); }
     int getCorrectMatches() const { return correctMatches; }
+    int getNearMatches() const { return nearMatches; }
+
+    // 힌트: 단어 번호(= 입력칸 번호)와 거리, 힌트가 없으면 -1
+    int getHintWord() const { return hintWord; }
+    int getHintDistance() const { return hintDistance; }
 
     // 추가: 레벨 및 문장 정보 접근
-    int getCurrentLevel() const { return dictionary->getCurrentLevel(); }
-    int getCurrentSentenceIndex() const { return dictionary->getCurrentSentenceIndex(); }
+    // (Dictionary 의 현재 문장은 미리 준비한 다음 라운드일 수 있으므로 지금 라운드 기준 값을 따로 가짐)
+    int getCurrentLevel() const { return currentLevel; }
+    int getCurrentSentenceIndex() const { return currentSentenceIndex; }
 
     // 추가: 전체 문장 반환 (화면에 표시용)
     std::string getFullSentence() const;
@@ -116,6 +217,8 @@ public:
     // 추가: Dictionary 접근 (필요 시)
     Dictionary *getDictionary() const { return dictionary; }
 
+    void setSessionId(int id) { sessionId = id; }
+
     bool getTimePanalty() const { return timePanalty; };
     void setTimePanalty(bool result) { timePanalty = result; };
 };
@@ -0,0 +1,107 @@
+#ifndef SENTENCESAMPLER_H
+#define SENTENCESAMPLER_H
+
+#include <cstdint>
+#include "GameRandom.h"
+
+// SentenceSampler: 한 레벨의 문장 인덱스를 중복 없이 뽑는 순열 순환 샘플러
+// - 배열을 만들지 않고 인덱스 순열 함수로 다음 인덱스를 계산 (메모리 O(1))
+// - 한 바퀴(레벨의 모든 문장)를 다 뽑기 전에는 같은 문장이 다시 나오지 않음
+// - 새 바퀴가 시작될 때도 직전 문장이 바로 다시 나오지 않도록 시작점을 조정
+// - 바퀴마다 순열 키는 넘겨받은 세션 난수(GameRandom)에서 뽑음
+class SentenceSampler
+{
+private:
+    uint32_t count;    // 레벨의 문장 개수
+    uint32_t position; // 현재 바퀴에서 뽑은 개수
+    uint32_t key;      // 이번 바퀴의 순열 키
+    uint32_t offset;   // 이번 바퀴의 시작점 회전량
+    int64_t lastIndex; // 직전에 뽑은 인덱스 (-1: 없음)
+
+    // [0, n) 위의 전단사 함수 (Kensler, "Correlated Multi-Jittered Sampling")
+    // 2의 거듭제곱 범위에서 섞은 뒤 n 이상이면 다시 섞는 cycle-walking 방식
+    static uint32_t permute(uint32_t i, uint32_t n, uint32_t p)
+    {
+        uint32_t w = n - 1;
+        w |= w >> 1;
+        w |= w >> 2;
+        w |= w >> 4;
+        w |= w >> 8;
+        w |= w >> 16;
+        do
+        {
+            i ^= p;
+            i *= 0xe170893du;
+            i ^= p >> 16;
+            i ^= (i & w) >> 4;
+            i ^= p >> 8;
+            i *= 0x0929eb3fu;
+            i ^= p >> 23;
+            i ^= (i & w) >> 1;
+            i *= 1u | p >> 27;
+            i *= 0x6935fa69u;
+            i ^= (i & w) >> 11;
+            i *= 0x74dcb303u;
+            i ^= (i & w) >> 2;
+            i *= 0x9e501cc3u;
+            i ^= (i & w) >> 2;
+            i *= 0xc860a3dfu;
+            i &= w;
+            i ^= i >> 5;
+        } while (i >= n);
+        return static_cast<uint32_t>((static_cast<uint64_t>(i) + p) % n);
+    }
+
+    // 새 바퀴 시작: 키를 바꾸고, 첫 문장이 직전 문장과 같으면 시작점을 한 칸 회전
+    void startCycle(GameRandom &random)
+    {
+        position = 0;
+        offset = 0;
+        key = static_cast<uint32_t>(random());
+        if (count > 1 && lastIndex >= 0 && permute(0, count, key) == static_cast<uint32_t>(lastIndex))
+        {
+            offset = 1;
+        }
+    }
+
+public:
+    SentenceSampler() : count(0), position(0), key(0), offset(0), lastIndex(-1) {}
+
+    SentenceSampler(uint32_t sentenceCount, GameRandom &random) : SentenceSampler()
+    {
+        reset(sentenceCount, random);
+    }
+
+    // 문장 개수가 바뀌면 (코퍼스 재로드 등) 새로 시작
+    void reset(uint32_t sentenceCount, GameRandom &random)
+    {
+        count = sentenceCount;
+        lastIndex = -1;
+        startCycle(random);
+    }
+
+    // 다음 문장 인덱스 반환 (count가 0이면 0)
+    uint32_t next(GameRandom &random)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        if (position >= count)
+        {
+            startCycle(random);
+        }
+
+        uint32_t slot = (position + offset) % count;
+        uint32_t index = permute(slot, count, key);
+        position++;
+        lastIndex = index;
+        return index;
+    }
+
+    // 이번 바퀴에서 아직 나오지 않은 문장 수
+    uint32_t remaining() const { return count - position; }
+    uint32_t size() const { return count; }
+};
+
+#endif // SENTENCESAMPLER_H
@@ -0,0 +1,359 @@
+#ifndef SESSIONRECORDER_H
+#define SESSIONRECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ncurses.h>
+#include "FrameBuffer.h"
+
+// SessionRecorder: PlayScreen 화면을 asciicast v2 파일로 기록 (asciinema play / 웹 플레이어로 재생)
+// SNOWMAN_RECORD_FILE 환경 변수에 파일 경로가 있을 때만 켜짐 (PlayScreen 참고)
+// - 게임 스레드: record() 가 지난번 기록한 프레임과 비교해 바뀐 칸만 터미널 출력 바이트(ANSI)로 만들고
+//   잠금 없는 단일 생산자/단일 소비자 큐에 복사만 함 (시스템 호출, 할당, 대기 없음)
+// - 기록 스레드: 큐에서 꺼내 JSON 문자열로 바꿔 파일에 씀
+// - KEYFRAME_MILLIS 마다 화면 전체를 다시 그리고 바로 앞에 "m" (marker) 이벤트를 남겨서,
+//   플레이어가 표시 지점으로 건너뛰어도 그 뒤 화면이 온전함
+// - 큐가 가득 차면 그 프레임은 버리고 기준 프레임을 그대로 두므로 다음 프레임에 변경이 함께 실림
+class SessionRecorder
+{
+public:
+    static const size_t QUEUE_BYTES = 1 << 22; // 2의 거듭제곱 (키프레임 하나는 수십 KB)
+    static const int KEYFRAME_MILLIS = 5000;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // 큐 안의 기록 하나: [RecordHeader][length 바이트] (8바이트 단위로 맞춤)
+    struct RecordHeader
+    {
+        uint64_t micros; // 기록 시작부터
+        uint32_t length;
+        uint32_t keyframe;
+    };
+
+    // 단일 생산자/단일 소비자 바이트 큐 (쓰는 위치/읽는 위치는 계속 증가, 실제 위치는 % QUEUE_BYTES)
+    std::unique_ptr<uint8_t[]> queue;
+    std::atomic<uint64_t> writePos; // 게임 스레드만 씀
+    std::atomic<uint64_t> readPos;  // 기록 스레드만 씀
+
+    // 게임 스레드 전용
+    std::unique_ptr<FrameBuffer> recorded; // 마지막으로 큐에 넣은 프레임 (델타 기준)
+    std::string scratch;                   // 이번 프레임의 출력 바이트
+    Clock::time_point origin;
+    uint64_t lastKeyframeMicros;
+    bool needKeyframe;
+    short pairForeground[8]; // 색 쌍 번호 -> curses 색 (start() 때 pair_content 로 읽어 둠)
+    short pairBackground[8];
+
+    // 기록 스레드 전용
+    FILE *file;
+    std::string line;
+    std::unique_ptr<std::thread> writer;
+    std::atomic<bool> stopping;
+
+    std::atomic<uint64_t> frames;
+    std::atomic<uint64_t> droppedFrames;
+    std::atomic<uint64_t> bytesWritten;
+
+    SessionRecorder(const SessionRecorder &) = delete;
+    SessionRecorder &operator=(const SessionRecorder &) = delete;
+
+    static uint64_t roundUp(uint64_t size) { return (size + 7) & ~static_cast<uint64_t>(7); }
+
+    void copyIn(uint64_t position, const void *data, size_t size)
+    {
+        size_t offset = static_cast<size_t>(position % QUEUE_BYTES);
+        size_t first = size < QUEUE_BYTES - offset ? size : QUEUE_BYTES - offset;
+        memcpy(queue.get() + offset, data, first);
+        memcpy(queue.get(), static_cast<const uint8_t *>(data) + first, size - first);
+    }
+
+    void copyOut(uint64_t position, void *data, size_t size) const
+    {
+        size_t offset = static_cast<size_t>(position % QUEUE_BYTES);
+        size_t first = size < QUEUE_BYTES - offset ? size : QUEUE_BYTES - offset;
+        memcpy(data, queue.get() + offset, first);
+        memcpy(static_cast<uint8_t *>(data) + first, queue.get(), size - first);
+    }
+
+    void appendNumber(int value)
+    {
+        char digits[12];
+        int count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (count > 0)
+            scratch.push_back(digits[--count]);
+    }
+
+    // 속성과 색이 바뀔 때만 SGR 을 다시 냄
+    void appendStyle(const FrameBuffer::Cell &cell)
+    {
+        scratch.append("\033[0");
+        if (cell.attrs & A_BOLD)
+            scratch.append(";1");
+        if (cell.attrs & A_DIM)
+            scratch.append(";2");
+        if (cell.attrs & A_UNDERLINE)
+            scratch.append(";4");
+        if (cell.attrs & A_BLINK)
+            scratch.append(";5");
+        if (cell.attrs & A_REVERSE)
+            scratch.append(";7");
+        if (cell.pair > 0 && cell.pair < 8)
+        {
+            if (pairForeground[cell.pair] >= 0 && pairForeground[cell.pair] < 8)
+            {
+                scratch.append(";3");
+                appendNumber(pairForeground[cell.pair]);
+            }
+            if (pairBackground[cell.pair] >= 0 && pairBackground[cell.pair] < 8)
+            {
+                scratch.append(";4");
+                appendNumber(pairBackground[cell.pair]);
+            }
+        }
+        scratch.push_back('m');
+    }
+
+    void appendCells(int y, int x, const FrameBuffer::Cell *cells, int length, const FrameBuffer::Cell *&style)
+    {
+        scratch.append("\033[");
+        appendNumber(y + 1);
+        scratch.push_back(';');
+        appendNumber(x + 1);
+        scratch.push_back('H');
+        for (int i = 0; i < length; i++)
+        {
+            if (!style || cells[i].attrs != style->attrs || cells[i].pair != style->pair)
+            {
+                appendStyle(cells[i]);
+                style = &cells[i];
+            }
+            unsigned char glyph = static_cast<unsigned char>(cells[i].glyph);
+            scratch.push_back(glyph >= 32 && glyph < 127 ? static_cast<char>(glyph) : '?');
+        }
+    }
+
+    // scratch 에 이번 프레임의 출력 바이트를 만듦 (바뀐 것이 없으면 빈 문자열)
+    void encode(const FrameBuffer &frame, bool keyframe)
+    {
+        scratch.clear();
+        const FrameBuffer::Cell *style = nullptr;
+        int cols = frame.getWidth();
+        if (keyframe)
+            scratch.append("\033[?25l\033[0m\033[2J");
+        for (int y = 0; y < frame.getHeight(); y++)
+        {
+            const FrameBuffer::Cell *row = frame.row(y);
+            if (keyframe)
+            {
+                appendCells(y, 0, row, cols, style);
+                continue;
+            }
+            const FrameBuffer::Cell *old = recorded->row(y);
+            int x = 0;
+            while (x < cols)
+            {
+                while (x < cols && row[x] == old[x])
+                    x++;
+                if (x >= cols)
+                    break;
+                int start = x;
+                while (x < cols && row[x] != old[x])
+                    x++;
+                appendCells(y, start, row + start, x - start, style);
+            }
+        }
+    }
+
+    // 기록 스레드: 출력 바이트를 JSON 문자열 안에 넣을 수 있게 바꿔 line 에 붙임
+    void appendEscaped(const uint8_t *data, size_t size)
+    {
+        static const char HEX[] = "0123456789abcdef";
+        for (size_t i = 0; i < size; i++)
+        {
+            char c = static_cast<char>(data[i]);
+            if (c == '"' || c == '\\')
+            {
+                line.push_back('\\');
+                line.push_back(c);
+            }
+            else if (data[i] < 32)
+            {
+                line.append("\\u00");
+                line.push_back(HEX[data[i] >> 4]);
+                line.push_back(HEX[data[i] & 15]);
+            }
+            else
+            {
+                line.push_back(c);
+            }
+        }
+    }
+
+    void writeEvent(uint64_t micros, const char *type, const uint8_t *data, size_t size)
+    {
+        char time[32];
+        snprintf(time, sizeof(time), "[%llu.%06llu, \"", static_cast<unsigned long long>(micros / 1000000),
+                 static_cast<unsigned long long>(micros % 1000000));
+        line.assign(time);
+        line.append(type);
+        line.append("\", \"");
+        appendEscaped(data, size);
+        line.append("\"]\n");
+        fwrite(line.data(), 1, line.size(), file);
+        bytesWritten.fetch_add(line.size(), std::memory_order_relaxed);
+    }
+
+    // 큐에 쌓인 기록을 모두 파일로 (쌓인 것이 있었으면 true)
+    bool drain(std::vector<uint8_t> &payload)
+    {
+        uint64_t read = readPos.load(std::memory_order_relaxed);
+        uint64_t written = writePos.load(std::memory_order_acquire);
+        if (read == written)
+            return false;
+        while (read != written)
+        {
+            RecordHeader header;
+            copyOut(read, &header, sizeof(header));
+            payload.resize(header.length);
+            copyOut(read + sizeof(header), payload.data(), header.length);
+            if (header.keyframe)
+            {
+                static const uint8_t LABEL[] = "keyframe";
+                writeEvent(header.micros, "m", LABEL, sizeof(LABEL) - 1);
+            }
+            writeEvent(header.micros, "o", payload.data(), payload.size());
+            read += roundUp(sizeof(header) + header.length);
+            readPos.store(read, std::memory_order_release);
+        }
+        fflush(file);
+        return true;
+    }
+
+    void run()
+    {
+        std::vector<uint8_t> payload;
+        const std::chrono::milliseconds idle(20); // 큐가 비었을 때 쉬는 시간
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            if (!drain(payload))
+                std::this_thread::sleep_for(idle);
+        }
+        drain(payload);
+    }
+
+public:
+    SessionRecorder() : writePos(0), readPos(0), lastKeyframeMicros(0), needKeyframe(true), file(nullptr),
+                        stopping(false), frames(0), droppedFrames(0), bytesWritten(0) {}
+    ~SessionRecorder() { stop(); }
+
+    // path 가 비어 있거나 nullptr 이면 아무것도 하지 않음. 색 쌍은 start_color/init_pair 뒤에 읽음
+    bool start(const char *path, int rows, int cols)
+    {
+        if (!path || !*path || file || rows <= 0 || cols <= 0)
+            return false;
+        file = fopen(path, "w");
+        if (!file)
+            return false;
+
+        // asciicast v2 머리 줄
+        const char *term = getenv("TERM");
+        fprintf(file, "{\"version\": 2, \"width\": %d, \"height\": %d, \"timestamp\": %lld, "
+                      "\"title\": \"snowman\", \"env\": {\"TERM\": \"%s\"}}\n",
+                cols, rows, static_cast<long long>(time(nullptr)),
+                term && !strpbrk(term, "\"\\") ? term : "xterm-256color");
+
+        for (int pair = 0; pair < 8; pair++)
+        {
+            pairForeground[pair] = -1;
+            pairBackground[pair] = -1;
+            if (pair > 0 && has_colors())
+                pair_content(static_cast<short>(pair), &pairForeground[pair], &pairBackground[pair]);
+        }
+
+        queue.reset(new uint8_t[QUEUE_BYTES]);
+        writePos.store(0, std::memory_order_relaxed);
+        readPos.store(0, std::memory_order_relaxed);
+        recorded.reset(new FrameBuffer(rows, cols));
+        scratch.reserve(static_cast<size_t>(rows) * cols * 24); // 칸마다 SGR 이 붙는 최악의 키프레임
+        line.reserve(scratch.capacity() * 6);
+        origin = Clock::now();
+        lastKeyframeMicros = 0;
+        needKeyframe = true;
+        stopping.store(false, std::memory_order_relaxed);
+        writer.reset(new std::thread(&SessionRecorder::run, this));
+        return true;
+    }
+
+    // 남은 기록을 모두 쓰고 파일을 닫음
+    void stop()
+    {
+        if (!file)
+            return;
+        stopping.store(true, std::memory_order_release);
+        if (writer)
+        {
+            writer->join();
+            writer.reset();
+        }
+        fclose(file);
+        file = nullptr;
+    }
+
+    bool isRecording() const { return file != nullptr; }
+
+    // 게임 스레드: 화면에 내보낸 프레임을 기록 (바뀐 칸이 없으면 아무것도 안 함)
+    void record(const FrameBuffer &frame)
+    {
+        if (!file || frame.getHeight() != recorded->getHeight() || frame.getWidth() != recorded->getWidth())
+            return;
+
+        uint64_t micros = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin).count());
+        bool keyframe = needKeyframe || micros - lastKeyframeMicros >= static_cast<uint64_t>(KEYFRAME_MILLIS) * 1000;
+        encode(frame, keyframe);
+        if (scratch.empty())
+            return;
+
+        RecordHeader header = {micros, static_cast<uint32_t>(scratch.size()), keyframe ? 1u : 0u};
+        uint64_t size = roundUp(sizeof(header) + scratch.size());
+        uint64_t write = writePos.load(std::memory_order_relaxed);
+        if (write + size - readPos.load(std::memory_order_acquire) > QUEUE_BYTES)
+        {
+            // 기록 스레드가 밀림: 이번 프레임은 버리고 기준 프레임을 그대로 둠
+            droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        copyIn(write, &header, sizeof(header));
+        copyIn(write + sizeof(header), scratch.data(), scratch.size());
+        writePos.store(write + size, std::memory_order_release);
+
+        *recorded = frame;
+        if (keyframe)
+        {
+            lastKeyframeMicros = micros;
+            needKeyframe = false;
+        }
+        frames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t getFrames() const { return frames.load(std::memory_order_relaxed); }
+    uint64_t getDroppedFrames() const { return droppedFrames.load(std::memory_order_relaxed); }
+    uint64_t getBytesWritten() const { return bytesWritten.load(std::memory_order_relaxed); }
+};
+
+#endif // SESSIONRECORDER_H
@@ -0,0 +1,358 @@
+#include "SnowDict.h"
+#include "Dictionary.h"
+#include "Tokenizer.h"
+#include <cstring>
+#include <cstdio>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// ========== 공통 ==========
+
+uint32_t SnowDict::foldedHash(const char *text, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 'A' && c <= 'Z')
+        {
+            c = static_cast<unsigned char>(c - 'A' + 'a');
+        }
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint64_t alignTo8(uint64_t value)
+{
+    return (value + 7) & ~static_cast<uint64_t>(7);
+}
+
+// ========== 컴파일 (쓰기) ==========
+
+namespace
+{
+    // 중복 제거 문자열 풀
+    class StringPoolBuilder
+    {
+    private:
+        std::unordered_map<std::string, uint32_t> ids;
+
+    public:
+        std::vector<SnowDictString> entries;
+        std::string pool;
+
+        uint32_t intern(const std::string &text)
+        {
+            auto it = ids.find(text);
+            if (it != ids.end())
+            {
+                return it->second;
+            }
+
+            SnowDictString entry;
+            entry.offset = static_cast<uint32_t>(pool.size());
+            entry.length = static_cast<uint16_t>(text.size());
+            entry.reserved = 0;
+            entry.foldedHash = SnowDict::foldedHash(text.data(), text.size());
+
+            pool += text;
+            pool += '\0';
+
+            uint32_t id = static_cast<uint32_t>(entries.size());
+            entries.push_back(entry);
+            ids.emplace(text, id);
+            return id;
+        }
+    };
+
+    bool writeSection(FILE *file, uint64_t offset, const void *bytes, size_t length)
+    {
+        if (fseek(file, static_cast<long>(offset), SEEK_SET) != 0)
+        {
+            return false;
+        }
+        return length == 0 || fwrite(bytes, 1, length, file) == length;
+    }
+}
+
+bool SnowDict::write(const std::string &path,
+                     const std::map<int, std::vector<std::string>> &levelSentences,
+                     int wordsPerSentence, int &skipped, std::string &error)
+{
+    StringPoolBuilder strings;
+    std::vector<SnowDictLevel> levels;
+    std::vector<uint32_t> levelIndex;
+    std::vector<SnowDictSentence> sentences;
+    std::vector<uint32_t> tokens;
+    TokenTable words; // 문장마다 다시 씀 (Dictionary::splitSentenceIntoWords 와 같은 규칙)
+    std::string word;
+
+    for (const auto &entry : levelSentences)
+    {
+        SnowDictLevel level;
+        level.level = entry.first;
+        level.firstIndex = static_cast<uint32_t>(levelIndex.size());
+        level.count = 0;
+        level.reserved = 0;
+
+        for (const std::string &text : entry.second)
+        {
+            words.clear();
+            words.tokenize(text);
+            if (static_cast<int>(words.size()) != wordsPerSentence || text.size() > UINT16_MAX)
+            {
+                skipped++;
+                continue;
+            }
+
+            SnowDictSentence sentence;
+            sentence.textString = strings.intern(text);
+            sentence.firstToken = static_cast<uint32_t>(tokens.size());
+            sentence.tokenCount = static_cast<uint16_t>(words.size());
+            sentence.reserved = 0;
+            for (size_t i = 0; i < words.size(); i++)
+            {
+                word.assign(words[i]);
+                tokens.push_back(strings.intern(word));
+            }
+
+            levelIndex.push_back(static_cast<uint32_t>(sentences.size()));
+            sentences.push_back(sentence);
+            level.count++;
+        }
+
+        if (level.count > 0)
+        {
+            levels.push_back(level);
+        }
+    }
+
+    if (sentences.empty())
+    {
+        error = "no valid sentences";
+        return false;
+    }
+    // 헤더의 개수와 풀 오프셋은 32비트
+    if (strings.pool.size() > UINT32_MAX || tokens.size() > UINT32_MAX || strings.entries.size() > UINT32_MAX)
+    {
+        error = "corpus too large for snowdict (string pool over 4 GiB)";
+        return false;
+    }
+
+    // 섹션 배치
+    SnowDictHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNOWDICT_MAGIC, sizeof(header.magic));
+    header.version = SNOWDICT_VERSION;
+    header.levelCount = static_cast<uint32_t>(levels.size());
+    header.sentenceCount = static_cast<uint32_t>(sentences.size());
+    header.tokenCount = static_cast<uint32_t>(tokens.size());
+    header.stringCount = static_cast<uint32_t>(strings.entries.size());
+    header.poolSize = static_cast<uint32_t>(strings.pool.size());
+
+    header.levelTableOffset = alignTo8(sizeof(SnowDictHeader));
+    header.levelIndexOffset = alignTo8(header.levelTableOffset + levels.size() * sizeof(SnowDictLevel));
+    header.sentenceTableOffset = alignTo8(header.levelIndexOffset + levelIndex.size() * sizeof(uint32_t));
+    header.tokenTableOffset = alignTo8(header.sentenceTableOffset + sentences.size() * sizeof(SnowDictSentence));
+    header.stringTableOffset = alignTo8(header.tokenTableOffset + tokens.size() * sizeof(uint32_t));
+    header.poolOffset = alignTo8(header.stringTableOffset + strings.entries.size() * sizeof(SnowDictString));
+    header.fileSize = header.poolOffset + strings.pool.size();
+
+    // 임시 파일에 쓴 뒤 rename 으로 교체 (읽는 쪽이 반쯤 쓰인 파일을 보지 않도록)
+    std::string tempPath = path + ".tmp";
+    FILE *file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        error = "cannot open " + tempPath;
+        return false;
+    }
+
+    bool ok = writeSection(file, 0, &header, sizeof(header)) &&
+              writeSection(file, header.levelTableOffset, levels.data(), levels.size() * sizeof(SnowDictLevel)) &&
+              writeSection(file, header.levelIndexOffset, levelIndex.data(), levelIndex.size() * sizeof(uint32_t)) &&
+              writeSection(file, header.sentenceTableOffset, sentences.data(), sentences.size() * sizeof(SnowDictSentence)) &&
+              writeSection(file, header.tokenTableOffset, tokens.data(), tokens.size() * sizeof(uint32_t)) &&
+              writeSection(file, header.stringTableOffset, strings.entries.data(), strings.entries.size() * sizeof(SnowDictString)) &&
+              writeSection(file, header.poolOffset, strings.pool.data(), strings.pool.size());
+
+    if (fclose(file) != 0)
+    {
+        ok = false;
+    }
+    if (!ok || rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        unlink(tempPath.c_str());
+        error = "write failed: " + path;
+        return false;
+    }
+    return true;
+}
+
+// ========== 로드 (mmap 뷰) ==========
+
+bool SnowDictView::open(const std::string &path, std::string &error)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SnowDictHeader)))
+    {
+        ::close(fd);
+        error = "not a snowdict file: " + path;
+        return false;
+    }
+
+    void *mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        error = "mmap failed: " + path;
+        return false;
+    }
+
+    data = static_cast<const unsigned char *>(mapped);
+    size = static_cast<size_t>(st.st_size);
+    header = reinterpret_cast<const SnowDictHeader *>(data);
+
+    // 헤더와 섹션 범위만 확인 (오프셋은 8바이트 정렬, 섹션은 파일 안)
+    // 항목별 번호는 조회할 때 확인하므로 여기서 테이블을 훑지 않음 (페이지를 미리 읽지 않음)
+    const SnowDictHeader &h = *header;
+    auto fits = [this](uint64_t offset, uint64_t bytes)
+    {
+        return offset % 8 == 0 && offset <= size && bytes <= size - offset;
+    };
+    bool valid = memcmp(h.magic, SNOWDICT_MAGIC, sizeof(h.magic)) == 0 &&
+                 h.version == SNOWDICT_VERSION &&
+                 h.fileSize == size &&
+                 fits(h.levelTableOffset, static_cast<uint64_t>(h.levelCount) * sizeof(SnowDictLevel)) &&
+                 fits(h.levelIndexOffset, static_cast<uint64_t>(h.sentenceCount) * sizeof(uint32_t)) &&
+                 fits(h.sentenceTableOffset, static_cast<uint64_t>(h.sentenceCount) * sizeof(SnowDictSentence)) &&
+                 fits(h.tokenTableOffset, static_cast<uint64_t>(h.tokenCount) * sizeof(uint32_t)) &&
+                 fits(h.stringTableOffset, static_cast<uint64_t>(h.stringCount) * sizeof(SnowDictString)) &&
+                 fits(h.poolOffset, h.poolSize);
+    if (valid)
+    {
+        levels = reinterpret_cast<const SnowDictLevel *>(data + h.levelTableOffset);
+        levelIndex = reinterpret_cast<const uint32_t *>(data + h.levelIndexOffset);
+        sentences = reinterpret_cast<const SnowDictSentence *>(data + h.sentenceTableOffset);
+        tokens = reinterpret_cast<const uint32_t *>(data + h.tokenTableOffset);
+        strings = reinterpret_cast<const SnowDictString *>(data + h.stringTableOffset);
+        pool = reinterpret_cast<const char *>(data + h.poolOffset);
+    }
+    if (!valid)
+    {
+        close();
+        error = "corrupt snowdict file: " + path;
+        return false;
+    }
+    return true;
+}
+
+void SnowDictView::close()
+{
+    if (data)
+    {
+        munmap(const_cast<unsigned char *>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    levels = nullptr;
+    levelIndex = nullptr;
+    sentences = nullptr;
+    tokens = nullptr;
+    strings = nullptr;
+    pool = nullptr;
+}
+
+const SnowDictLevel *SnowDictView::findLevel(int level) const
+{
+    // 레벨 수는 몇 개 안 되므로 선형 탐색
+    for (uint32_t i = 0; i < getLevelCount(); i++)
+    {
+        if (levels[i].level == level)
+        {
+            return &levels[i];
+        }
+    }
+    return nullptr;
+}
+
+int SnowDictView::getSentenceCount(int level) const
+{
+    const SnowDictLevel *entry = findLevel(level);
+    return entry ? static_cast<int>(entry->count) : 0;
+}
+
+uint32_t SnowDictView::getSentenceId(int level, int sentenceIndex) const
+{
+    const SnowDictLevel *entry = findLevel(level);
+    if (!entry || sentenceIndex < 0 || static_cast<uint32_t>(sentenceIndex) >= entry->count)
+    {
+        return UINT32_MAX;
+    }
+    uint64_t position = static_cast<uint64_t>(entry->firstIndex) + static_cast<uint32_t>(sentenceIndex);
+    if (position >= header->sentenceCount || levelIndex[position] >= header->sentenceCount)
+    {
+        return UINT32_MAX;
+    }
+    return levelIndex[position];
+}
+
+uint32_t SnowDictView::getWordCount(uint32_t sentenceId) const
+{
+    if (!header || sentenceId >= header->sentenceCount)
+    {
+        return 0;
+    }
+    const SnowDictSentence &sentence = sentences[sentenceId];
+    if (static_cast<uint64_t>(sentence.firstToken) + sentence.tokenCount > header->tokenCount)
+    {
+        return 0;
+    }
+    return sentence.tokenCount;
+}
+
+std::string_view SnowDictView::getWord(uint32_t sentenceId, uint32_t wordIndex) const
+{
+    if (wordIndex >= getWordCount(sentenceId))
+    {
+        return std::string_view();
+    }
+    return getString(tokens[sentences[sentenceId].firstToken + wordIndex]);
+}
+
+std::string_view SnowDictView::getText(uint32_t sentenceId) const
+{
+    if (!header || sentenceId >= header->sentenceCount)
+    {
+        return std::string_view();
+    }
+    return getString(sentences[sentenceId].textString);
+}
+
+std::string_view SnowDictView::getString(uint32_t stringIndex) const
+{
+    if (stringIndex >= header->stringCount)
+    {
+        return std::string_view();
+    }
+    const SnowDictString &entry = strings[stringIndex];
+    if (entry.offset > header->poolSize || entry.length > header->poolSize - entry.offset)
+    {
+        return std::string_view();
+    }
+    return std::string_view(pool + entry.offset, entry.length);
+}
@@ -0,0 +1,127 @@
+#ifndef SNOWDICT_H
+#define SNOWDICT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+
+// ===== .snowdict 바이너리 코퍼스 포맷 =====
+// snowdict-compile 이 미리 만들어 두고, Dictionary 는 mmap 으로 그대로 사용한다.
+// 시작 시 문장 분리/토큰화가 전혀 없고, 열 때는 헤더와 섹션 범위만 확인한다 (파일 크기와 무관).
+//
+// [Header]
+// [Level 테이블]      SnowDictLevel[levelCount]       레벨 번호 -> 인덱스 테이블 범위
+// [Level 인덱스 테이블] uint32_t[sentenceCount]         레벨별 문장 번호 목록
+// [Sentence 테이블]   SnowDictSentence[sentenceCount] 문장 원문 + 단어 토큰 범위
+// [Token 테이블]      uint32_t[tokenCount]            문장별 단어 -> 문자열 번호
+// [String 테이블]     SnowDictString[stringCount]     풀 오프셋, 길이, 소문자 해시
+// [String 풀]         char[poolSize]                  중복 제거된 문자열 (NUL 종료)
+//
+// 모든 섹션은 8바이트 정렬, 정수는 리틀 엔디언, 오프셋은 파일 시작 기준.
+
+static const char SNOWDICT_MAGIC[8] = {'S', 'N', 'O', 'W', 'D', 'I', 'C', 'T'};
+static const uint32_t SNOWDICT_VERSION = 1;
+
+struct SnowDictHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t levelCount;
+    uint32_t sentenceCount;
+    uint32_t tokenCount;
+    uint32_t stringCount;
+    uint32_t poolSize;
+    uint64_t levelTableOffset;
+    uint64_t levelIndexOffset;
+    uint64_t sentenceTableOffset;
+    uint64_t tokenTableOffset;
+    uint64_t stringTableOffset;
+    uint64_t poolOffset;
+    uint64_t fileSize;
+};
+
+struct SnowDictLevel
+{
+    int32_t level;
+    uint32_t firstIndex; // Level 인덱스 테이블 안의 시작 위치
+    uint32_t count;      // 레벨의 문장 개수
+    uint32_t reserved;
+};
+
+struct SnowDictSentence
+{
+    uint32_t textString; // 문장 원문의 문자열 번호
+    uint32_t firstToken; // Token 테이블 안의 시작 위치
+    uint16_t tokenCount; // 단어 개수
+    uint16_t reserved;
+};
+
+struct SnowDictString
+{
+    uint32_t offset;     // 풀 안의 위치
+    uint16_t length;     // 바이트 길이 (NUL 제외)
+    uint16_t reserved;
+    uint32_t foldedHash; // 소문자로 바꾼 뒤의 FNV-1a 해시 (대소문자 무시 비교용)
+};
+
+namespace SnowDict
+{
+    // 대소문자 무시 FNV-1a 해시 (입력 비교와 같은 규칙: ASCII tolower)
+    uint32_t foldedHash(const char *text, size_t length);
+
+    // 레벨별 문장 목록을 .snowdict 파일로 저장
+    // 단어 수가 wordsPerSentence 와 다른 문장은 건너뛰고 skipped 에 개수를 더함
+    bool write(const std::string &path,
+               const std::map<int, std::vector<std::string>> &levelSentences,
+               int wordsPerSentence, int &skipped, std::string &error);
+}
+
+// SnowDictView: mmap 한 .snowdict 파일의 읽기 전용 뷰
+// 열 때는 헤더와 섹션 범위만 확인하고, 테이블 사이의 번호(레벨 -> 문장, 문장 -> 토큰, 토큰 -> 문자열,
+// 문자열 -> 풀)는 조회할 때 그 항목만 확인한다. 깨진 항목의 조회는 UINT32_MAX, 0, 빈 문자열로 실패한다.
+class SnowDictView
+{
+private:
+    const unsigned char *data;
+    size_t size;
+    const SnowDictHeader *header;
+    const SnowDictLevel *levels;
+    const uint32_t *levelIndex;
+    const SnowDictSentence *sentences;
+    const uint32_t *tokens;
+    const SnowDictString *strings;
+    const char *pool;
+
+    SnowDictView(const SnowDictView &) = delete;
+    SnowDictView &operator=(const SnowDictView &) = delete;
+
+    const SnowDictLevel *findLevel(int level) const;
+    std::string_view getString(uint32_t stringIndex) const;
+
+public:
+    SnowDictView() : data(nullptr), size(0), header(nullptr), levels(nullptr), levelIndex(nullptr),
+                     sentences(nullptr), tokens(nullptr), strings(nullptr), pool(nullptr) {}
+    ~SnowDictView() { close(); }
+
+    bool open(const std::string &path, std::string &error);
+    void close();
+    bool isOpen() const { return data != nullptr; }
+
+    uint32_t getLevelCount() const { return header ? header->levelCount : 0; }
+    int getLevelAt(uint32_t i) const { return i < getLevelCount() ? levels[i].level : 0; }
+    int getSentenceCount(int level) const;
+
+    // 레벨 안의 순번 -> 전체 문장 번호 (범위 밖이거나 깨졌으면 UINT32_MAX)
+    uint32_t getSentenceId(int level, int sentenceIndex) const;
+
+    // 문장의 단어 수 (번호가 범위 밖이거나 토큰 범위가 테이블 밖이면 0)
+    uint32_t getWordCount(uint32_t sentenceId) const;
+    // 문장의 단어 / 원문 (범위 밖이거나 깨졌으면 빈 문자열)
+    std::string_view getWord(uint32_t sentenceId, uint32_t wordIndex) const;
+    std::string_view getText(uint32_t sentenceId) const;
+};
+
+#endif // SNOWDICT_H
@@ -0,0 +1,255 @@
+#ifndef SNOWFALL_H
+#define SNOWFALL_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "RenderTarget.h"
+
+// Snowfall: 게임 영역 배경에 내리는 눈 (화면 효과일 뿐 게임 로직과는 상관없음)
+//
+// - 눈송이마다 위치(x, y), 떨어지는 속도, 옆으로 흐르는 속도가 따로 있고 세 겹(먼 눈 '.', 중간 '\'', 가까운 '*')으로 나뉨
+// - 값은 종류별 배열(SoA)에 4개씩 묶은 벡터(GCC 벡터 확장)로 두어 한 번에 눈송이 4개씩 움직임 (SSE/NEON 으로 컴파일됨)
+// - 움직인 뒤 칸마다 가장 가까운 눈송이의 모양을 cells 에 모으고, 화면에 그려 둔 모양(drawn)과 다른 칸만 다시 그림
+// - 단어 블록/아이템 박스처럼 눈 위에 그리는 칸은 cover() 로 표시해 두면 건드리지 않음
+//   (그런 칸이 바뀌면 게임 영역 전체를 다시 그리므로 drawAll() 이 다시 맞춤)
+//
+// 눈송이 수는 SNOWMAN_SNOWFLAKES (기본 300, 0 이면 끔), 시간은 GameClock 밀리초로 받음
+class Snowfall
+{
+public:
+    static const int DEFAULT_COUNT = 300;
+    static const int MAX_COUNT = 100000;
+    static const int FRAME_MILLIS = 100;    // 눈이 움직이는 간격 (10 fps, 터미널로 나가는 양을 줄이려고)
+    static const int MAX_STEP_MILLIS = 200; // 오래 멈췄다가 깨어나도 한 번에 이만큼만 움직임
+
+private:
+    typedef float Lane __attribute__((vector_size(16)));
+    typedef int32_t LaneInt __attribute__((vector_size(16)));
+    static const int LANES = 4;
+
+    int rows;
+    int cols;
+    int count; // LANES 의 배수
+    int64_t lastStepMillis;
+
+    std::vector<Lane> xs;
+    std::vector<Lane> ys;
+    std::vector<Lane> fallSpeeds;  // 칸/초
+    std::vector<Lane> driftSpeeds; // 칸/초 (음수면 왼쪽)
+    std::vector<LaneInt> cellIndex; // 움직인 뒤 눈송이가 있는 칸
+    std::vector<uint8_t> layers;    // 1..3 (클수록 가까움)
+
+    std::vector<uint8_t> cells;   // 칸마다 가장 가까운 눈송이 겹 (0: 없음)
+    std::vector<uint8_t> drawn;   // 화면에 그려 둔 겹
+    std::vector<uint8_t> covered; // 눈 위에 다른 것이 그려진 칸
+    std::vector<char> run;        // 한 줄에서 이어진 바뀐 칸을 한 번에 그릴 때 쓰는 버퍼
+
+    static char glyphOf(uint8_t layer)
+    {
+        static const char GLYPHS[4] = {' ', '.', '\'', '*'};
+        return GLYPHS[layer];
+    }
+
+    // 0 이상 1 미만 난수 (xorshift32)
+    static float nextUnit(uint32_t &state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return static_cast<float>(state >> 8) / 16777216.0f;
+    }
+
+    void collectCells()
+    {
+        memset(cells.data(), 0, cells.size());
+        const int32_t *index = reinterpret_cast<const int32_t *>(cellIndex.data());
+        for (int i = 0; i < count; i++)
+        {
+            uint8_t &cell = cells[static_cast<size_t>(index[i])];
+            cell = cell > layers[static_cast<size_t>(i)] ? cell : layers[static_cast<size_t>(i)];
+        }
+    }
+
+    // 한 줄에서 그릴 칸을 이어진 칸끼리 한 번에 그림 (덮인 칸에서 끊음)
+    // 눈이 사라진 칸은 clear() 한 창과 같도록 색 없이 공백으로
+    int drawRow(RenderTarget &window, int y, bool onlyChanged)
+    {
+        int drawnCells = 0;
+        int runStart = 0;
+        int runLength = 0;
+        bool runBlank = false;
+        for (int x = 0; x <= cols; x++)
+        {
+            size_t i = static_cast<size_t>(y) * cols + x;
+            bool paint = x < cols && !covered[i] && (onlyChanged ? cells[i] != drawn[i] : cells[i] != 0);
+            bool blank = paint && cells[i] == 0;
+            if (runLength > 0 && (!paint || blank != runBlank))
+            {
+                if (runBlank)
+                    window.attrOff(COLOR_PAIR(3));
+                window.print(y, runStart, "%.*s", runLength, run.data());
+                if (runBlank)
+                    window.attrOn(COLOR_PAIR(3));
+                drawnCells += runLength;
+                runLength = 0;
+            }
+            if (paint)
+            {
+                if (runLength == 0)
+                {
+                    runStart = x;
+                    runBlank = blank;
+                }
+                run[static_cast<size_t>(runLength++)] = glyphOf(cells[i]);
+            }
+        }
+        return drawnCells;
+    }
+
+public:
+    Snowfall(int fieldRows, int fieldCols, int flakeCount, uint32_t seed, int64_t nowMillis)
+        : rows(fieldRows > 0 ? fieldRows : 1), cols(fieldCols > 0 ? fieldCols : 1), lastStepMillis(nowMillis)
+    {
+        count = flakeCount < 0 ? 0 : flakeCount;
+        if (count > MAX_COUNT)
+            count = MAX_COUNT;
+        count = (count + LANES - 1) / LANES * LANES;
+        size_t lanes = static_cast<size_t>(count / LANES);
+        xs.resize(lanes);
+        ys.resize(lanes);
+        fallSpeeds.resize(lanes);
+        driftSpeeds.resize(lanes);
+        cellIndex.resize(lanes);
+        layers.resize(static_cast<size_t>(count));
+        cells.assign(static_cast<size_t>(rows) * cols, 0);
+        drawn.assign(cells.size(), 0);
+        covered.assign(cells.size(), 0);
+        run.resize(static_cast<size_t>(cols));
+
+        // 먼 눈일수록 느리고 덜 흔들림
+        uint32_t state = seed * 2654435761u + 1;
+        for (int i = 0; i < count; i++)
+        {
+            int layer = 1 + i % 3;
+            Lane &x = xs[static_cast<size_t>(i / LANES)];
+            x[i % LANES] = nextUnit(state) * cols;
+            ys[static_cast<size_t>(i / LANES)][i % LANES] = nextUnit(state) * rows;
+            fallSpeeds[static_cast<size_t>(i / LANES)][i % LANES] = (0.5f + 1.0f * layer) * (0.7f + 0.6f * nextUnit(state));
+            driftSpeeds[static_cast<size_t>(i / LANES)][i % LANES] = (nextUnit(state) - 0.5f) * layer;
+            layers[static_cast<size_t>(i)] = static_cast<uint8_t>(layer);
+        }
+        step(0.0f);
+    }
+
+    // SNOWMAN_SNOWFLAKES 값 (없거나 잘못되면 기본값)
+    static int configuredCount()
+    {
+        static const int configured = []()
+        {
+            const char *value = getenv("SNOWMAN_SNOWFLAKES");
+            if (!value || !*value)
+                return static_cast<int>(DEFAULT_COUNT);
+            char *end = nullptr;
+            long parsed = strtol(value, &end, 10);
+            if (*end != '\0' || parsed < 0)
+                return static_cast<int>(DEFAULT_COUNT);
+            return static_cast<int>(parsed > MAX_COUNT ? MAX_COUNT : parsed);
+        }();
+        return configured;
+    }
+
+    int getCount() const { return count; }
+    bool isEnabled() const { return count > 0; }
+
+    // 모든 눈송이를 seconds 만큼 움직이고 칸을 다시 모음
+    void step(float seconds)
+    {
+        const Lane width = Lane{} + static_cast<float>(cols);
+        const Lane height = Lane{} + static_cast<float>(rows);
+        const Lane zero = Lane{};
+        const LaneInt widthInt = LaneInt{} + cols;
+        const LaneInt heightInt = LaneInt{} + rows;
+        size_t lanes = xs.size();
+        for (size_t i = 0; i < lanes; i++)
+        {
+            Lane y = ys[i] + fallSpeeds[i] * seconds;
+            Lane x = xs[i] + driftSpeeds[i] * seconds;
+            y = y >= height ? y - height : y; // 바닥을 지나면 맨 위로
+            x = x >= width ? x - width : x;   // 옆으로 나가면 반대편으로
+            x = x < zero ? x + width : x;
+            ys[i] = y;
+            xs[i] = x;
+            // 반올림으로 정확히 폭/높이가 된 경우까지 칸 안으로
+            LaneInt row = __builtin_convertvector(y, LaneInt);
+            LaneInt col = __builtin_convertvector(x, LaneInt);
+            row = row >= heightInt ? row - heightInt : row;
+            col = col >= widthInt ? col - widthInt : col;
+            cellIndex[i] = row * cols + col;
+        }
+        collectCells();
+    }
+
+    // 지난번에 움직인 뒤 FRAME_MILLIS 가 지났으면 움직임 (움직였으면 true)
+    bool advance(int64_t nowMillis)
+    {
+        int64_t elapsed = nowMillis - lastStepMillis;
+        if (count == 0 || elapsed < FRAME_MILLIS)
+            return false;
+        lastStepMillis = nowMillis;
+        step(static_cast<float>(elapsed > MAX_STEP_MILLIS ? MAX_STEP_MILLIS : elapsed) / 1000.0f);
+        return true;
+    }
+
+    // 다음에 움직일 때까지 남은 밀리초 (눈이 꺼져 있으면 -1)
+    int millisUntilNextFrame(int64_t nowMillis) const
+    {
+        if (count == 0)
+            return -1;
+        int64_t wait = lastStepMillis + FRAME_MILLIS - nowMillis;
+        return wait < 0 ? 0 : static_cast<int>(wait);
+    }
+
+    // 덮인 칸 표시 (게임 영역을 다시 그릴 때마다 새로)
+    void clearCover() { memset(covered.data(), 0, covered.size()); }
+    void cover(int y, int x, int length)
+    {
+        if (y < 0 || y >= rows)
+            return;
+        int from = x < 0 ? 0 : x;
+        int to = x + length > cols ? cols : x + length;
+        if (to > from)
+            memset(&covered[static_cast<size_t>(y) * cols + from], 1, static_cast<size_t>(to - from));
+    }
+
+    // 비어 있는 창에 눈 전체를 그림 (덮인 칸 제외)
+    void drawAll(RenderTarget &window)
+    {
+        window.attrOn(COLOR_PAIR(3));
+        for (int y = 0; y < rows; y++)
+            drawRow(window, y, false);
+        window.attrOff(COLOR_PAIR(3));
+        memcpy(drawn.data(), cells.data(), cells.size());
+    }
+
+    // 그려 둔 뒤 바뀐 칸만 그림 (그린 칸 수 반환)
+    int drawChanged(RenderTarget &window)
+    {
+        if (memcmp(drawn.data(), cells.data(), cells.size()) == 0)
+            return 0;
+        int drawnCells = 0;
+        window.attrOn(COLOR_PAIR(3));
+        for (int y = 0; y < rows; y++)
+        {
+            size_t rowStart = static_cast<size_t>(y) * cols;
+            if (memcmp(&drawn[rowStart], &cells[rowStart], static_cast<size_t>(cols)) != 0)
+                drawnCells += drawRow(window, y, true);
+        }
+        window.attrOff(COLOR_PAIR(3));
+        memcpy(drawn.data(), cells.data(), cells.size());
+        return drawnCells;
+    }
+};
+
+#endif // SNOWFALL_H
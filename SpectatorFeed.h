@@ -0,0 +1,462 @@
+#ifndef SPECTATORFEED_H
+#define SPECTATORFEED_H
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "FrameBuffer.h"
+#include "UnixListener.h"
+
+// ===== 관전 메시지 포맷 =====
+// Unix SOCK_SEQPACKET 소켓의 메시지 하나가 프레임 하나 (경계가 유지되고, 보내기는 전부 아니면 EAGAIN)
+// [SpectatorHeader] 뒤에 runCount 개의 [SpectatorRun + FrameBuffer::Cell[length]]
+// - 키프레임: 모든 줄 전체 (받는 쪽은 화면을 이 내용으로 바꿈)
+// - 델타: 바로 앞 메시지 이후 바뀐 칸들만 (같은 줄에서 가까운 변경은 한 구간으로 묶음)
+// 정수는 리틀 엔디언, 셀은 FrameBuffer::Cell 의 8바이트 그대로.
+
+static const char SPECTATOR_MAGIC[4] = {'S', 'N', 'W', 'F'};
+
+struct SpectatorHeader
+{
+    char magic[4];
+    uint8_t type; // SpectatorFeed::KEYFRAME 또는 DELTA
+    uint8_t reserved[3];
+    uint32_t seq; // 메시지 번호 (관전자에게 번호가 건너뛰어 도착하면 그 메시지는 항상 키프레임)
+    uint16_t rows;
+    uint16_t cols;
+    uint32_t runCount;
+};
+
+struct SpectatorRun
+{
+    uint16_t y;
+    uint16_t x;
+    uint16_t length;
+    uint16_t reserved;
+};
+
+// SpectatorFeed: 실행 중인 PlayScreen 화면을 로컬 관전자 여럿에게 델타로 내보냄
+// SNOWMAN_SPECTATE_SOCKET 환경 변수에 소켓 경로가 있을 때만 켜짐 (PlayScreen 참고)
+// - 게임 스레드: publish() 가 남는 버퍼에 메시지를 만든 뒤 링 칸에 그 버퍼를 끼움 (버퍼는 미리 잡아 둔 것을 돌려 씀)
+// - 방송 스레드: 링 잠금 안에서는 보낼 버퍼에 핀만 꽂고, send() 는 잠금 밖에서 그 버퍼로 바로 (복사 없음, 논블로킹)
+//   -> 링 잠금은 양쪽 모두 포인터 몇 개를 바꿀 동안만 잡히므로 관전자 소켓이 게임 스레드를 붙잡지 못함
+// - 느린 관전자: 소켓이 차면 그 관전자만 기다리고, 링에서 밀려나면 가장 최근 키프레임으로 건너뜀
+class SpectatorFeed
+{
+public:
+    static const uint8_t KEYFRAME = 1;
+    static const uint8_t DELTA = 2;
+    static const int RING_SLOTS = 64;
+    static const int KEYFRAME_INTERVAL = 16; // 이 수만큼 메시지마다 키프레임 (링에 키프레임이 항상 여럿 남음)
+    static const int MAX_VIEWERS = 512;
+    static const int RUN_GAP = 1;            // 이 이하로 떨어진 변경은 한 구간으로 묶음 (구간 머리 8바이트 = 셀 하나)
+
+    // 받는 쪽: 메시지 하나를 frame 에 적용 (키프레임이 아니면 이전 내용 위에 덮어씀). 잘못된 메시지면 false
+    static bool apply(const uint8_t *data, size_t size, FrameBuffer &frame)
+    {
+        if (size < sizeof(SpectatorHeader))
+            return false;
+        SpectatorHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, SPECTATOR_MAGIC, sizeof(header.magic)) != 0 ||
+            header.rows != frame.getHeight() || header.cols != frame.getWidth())
+            return false;
+
+        size_t offset = sizeof(header);
+        for (uint32_t i = 0; i < header.runCount; i++)
+        {
+            SpectatorRun run;
+            if (offset + sizeof(run) > size)
+                return false;
+            memcpy(&run, data + offset, sizeof(run));
+            offset += sizeof(run);
+            size_t bytes = sizeof(FrameBuffer::Cell) * run.length;
+            if (offset + bytes > size || run.y >= header.rows || run.x + run.length > header.cols)
+                return false;
+            // 메시지 안의 셀 위치는 8바이트 정렬이 보장되지 않으므로 한 칸씩 복사
+            for (uint16_t k = 0; k < run.length; k++)
+            {
+                FrameBuffer::Cell cell;
+                memcpy(&cell, data + offset + k * sizeof(cell), sizeof(cell));
+                frame.setCells(run.y, run.x + k, &cell, 1);
+            }
+            offset += bytes;
+        }
+        return true;
+    }
+
+    static size_t maxMessageSize(int rows, int cols)
+    {
+        return sizeof(SpectatorHeader) +
+               static_cast<size_t>(rows) * (sizeof(SpectatorRun) + sizeof(FrameBuffer::Cell) * static_cast<size_t>(cols));
+    }
+
+private:
+    // 메시지 버퍼: 링에 들어간 뒤에는 바뀌지 않음. 핀이 꽂힌 버퍼는 링에서 밀려나도 핀이 빠질 때까지 돌려 쓰지 않음
+    struct Buffer
+    {
+        std::vector<uint8_t> bytes;
+        int pins = 0;        // 이 버퍼에서 보내는 중인 send() 수
+        bool inRing = false; // 링 칸에 들어 있음
+    };
+
+    // 링 RING_SLOTS 개 + 게임 스레드가 만드는 중인 것 1 + 밀려났지만 아직 보내는 중인 것 1
+    // (방송 스레드는 한 번에 버퍼 하나에만 핀을 꽂으므로 빈 목록이 비는 일은 없음)
+    static const int BUFFERS = RING_SLOTS + 2;
+
+    struct Viewer
+    {
+        int fd;
+        uint64_t nextSeq; // 다음에 보낼 메시지 번호
+        bool blocked;     // 소켓이 차서 POLLOUT 을 기다리는 중
+    };
+
+    UnixListener listener;
+    int wakeFds[2]; // 게임 스레드 -> 방송 스레드 알림 (pipe)
+
+    // 링 (ringMutex 로 보호: 링 칸, 빈 버퍼 목록, 버퍼의 pins/inRing)
+    std::mutex ringMutex;
+    Buffer buffers[BUFFERS];
+    Buffer *ring[RING_SLOTS];
+    Buffer *freeBuffers[BUFFERS];
+    int freeCount;
+    uint64_t head;          // 다음에 쓸 메시지 번호
+    uint64_t latestKeySeq;  // 가장 최근 키프레임 번호 (head == 0 이면 없음)
+
+    // 게임 스레드 전용
+    std::unique_ptr<FrameBuffer> sent; // 마지막으로 링에 넣은 프레임 (델타 기준)
+    Buffer *spare;                     // 다음 메시지를 만드는 버퍼 (빈 목록에서 가져옴)
+    int sinceKeyframe;
+
+    // 방송 스레드 전용
+    std::vector<Viewer> viewers;
+    Buffer *pinned; // 지금 핀을 꽂아 둔 버퍼 (다음 메시지를 잡을 때 또는 sendPending 끝에서 뺌)
+
+    // 통계
+    std::atomic<uint64_t> published;
+    std::atomic<uint64_t> viewerSkips;    // 느린 관전자를 키프레임으로 건너뛰게 한 횟수
+    std::atomic<int> viewerCount;
+
+    SpectatorFeed(const SpectatorFeed &) = delete;
+    SpectatorFeed &operator=(const SpectatorFeed &) = delete;
+
+    static void putRun(std::vector<uint8_t> &out, int y, int x, const FrameBuffer::Cell *cells, int length)
+    {
+        SpectatorRun run = {static_cast<uint16_t>(y), static_cast<uint16_t>(x), static_cast<uint16_t>(length), 0};
+        const uint8_t *runBytes = reinterpret_cast<const uint8_t *>(&run);
+        out.insert(out.end(), runBytes, runBytes + sizeof(run));
+        const uint8_t *cellBytes = reinterpret_cast<const uint8_t *>(cells);
+        out.insert(out.end(), cellBytes, cellBytes + sizeof(FrameBuffer::Cell) * static_cast<size_t>(length));
+    }
+
+    // out 에 메시지를 만듦 (구간 수 반환, seq 는 링에 넣을 때 채움)
+    uint32_t encode(const FrameBuffer &frame, bool keyframe, std::vector<uint8_t> &out)
+    {
+        out.clear();
+        SpectatorHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, SPECTATOR_MAGIC, sizeof(header.magic));
+        header.type = keyframe ? KEYFRAME : DELTA;
+        header.rows = static_cast<uint16_t>(frame.getHeight());
+        header.cols = static_cast<uint16_t>(frame.getWidth());
+        out.resize(sizeof(header));
+
+        uint32_t runs = 0;
+        int cols = frame.getWidth();
+        for (int y = 0; y < frame.getHeight(); y++)
+        {
+            const FrameBuffer::Cell *row = frame.row(y);
+            if (keyframe)
+            {
+                putRun(out, y, 0, row, cols);
+                runs++;
+                continue;
+            }
+            const FrameBuffer::Cell *old = sent->row(y);
+            if (memcmp(row, old, sizeof(FrameBuffer::Cell) * static_cast<size_t>(cols)) == 0)
+                continue;
+            int x = 0;
+            while (x < cols)
+            {
+                while (x < cols && row[x] == old[x])
+                    x++;
+                if (x >= cols)
+                    break;
+                int start = x;
+                int end = x + 1; // 마지막 변경 칸 다음
+                for (x = end; x < cols && x - end <= RUN_GAP; x++)
+                {
+                    if (row[x] != old[x])
+                        end = x + 1;
+                }
+                putRun(out, y, start, row + start, end - start);
+                runs++;
+                x = end;
+            }
+        }
+        header.runCount = runs;
+        memcpy(out.data(), &header, sizeof(header));
+        return runs;
+    }
+
+    void closeViewer(size_t index)
+    {
+        close(viewers[index].fd);
+        viewers[index] = viewers.back();
+        viewers.pop_back();
+        viewerCount.store(static_cast<int>(viewers.size()), std::memory_order_relaxed);
+    }
+
+    void acceptViewers()
+    {
+        while (true)
+        {
+            int fd = accept4(listener.getFd(), nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+            if (fd < 0)
+                return;
+            if (static_cast<int>(viewers.size()) >= MAX_VIEWERS)
+            {
+                close(fd);
+                continue;
+            }
+            // 새 관전자는 가장 최근 키프레임부터 (아직 없으면 첫 메시지부터)
+            std::lock_guard<std::mutex> lock(ringMutex);
+            viewers.push_back({fd, head > 0 ? latestKeySeq : 0, false});
+            viewerCount.store(static_cast<int>(viewers.size()), std::memory_order_relaxed);
+        }
+    }
+
+    // ringMutex 안에서: 핀이 빠진 버퍼가 링 밖이면 빈 목록으로
+    void releaseLocked(Buffer *buffer)
+    {
+        if (--buffer->pins == 0 && !buffer->inRing)
+            freeBuffers[freeCount++] = buffer;
+    }
+
+    // 관전자 한 명에게 보낼 다음 메시지에 핀을 꽂고 위치와 길이를 돌려줌 (보낼 것이 없으면 false)
+    // 앞서 꽂아 둔 핀은 같은 잠금 안에서 뺌
+    bool pinNext(Viewer &viewer, const uint8_t *&bytes, size_t &length)
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        if (pinned)
+        {
+            releaseLocked(pinned);
+            pinned = nullptr;
+        }
+        if (viewer.nextSeq >= head)
+            return false;
+        if (viewer.nextSeq + RING_SLOTS <= head)
+        {
+            // 링에서 밀려남: 빠진 델타는 되살릴 수 없으므로 최근 키프레임으로
+            viewer.nextSeq = latestKeySeq;
+            viewerSkips.fetch_add(1, std::memory_order_relaxed);
+        }
+        pinned = ring[viewer.nextSeq % RING_SLOTS];
+        pinned->pins++;
+        bytes = pinned->bytes.data();
+        length = pinned->bytes.size();
+        return true;
+    }
+
+    void unpin()
+    {
+        if (!pinned)
+            return;
+        std::lock_guard<std::mutex> lock(ringMutex);
+        releaseLocked(pinned);
+        pinned = nullptr;
+    }
+
+    // 관전자마다 밀린 메시지를 보냄 (소켓이 차면 그 관전자는 POLLOUT 대기)
+    void sendPending()
+    {
+        const uint8_t *bytes;
+        size_t length;
+        for (size_t i = 0; i < viewers.size();)
+        {
+            Viewer &viewer = viewers[i];
+            bool failed = false;
+            viewer.blocked = false;
+            while (pinNext(viewer, bytes, length))
+            {
+                // 핀이 꽂힌 버퍼는 게임 스레드가 건드리지 않으므로 잠금 없이 그대로 보냄
+                ssize_t written = send(viewer.fd, bytes, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+                if (written < 0)
+                {
+                    // 보내지 못한 메시지는 다음에 링에서 다시 잡음 (그 사이 밀려났으면 키프레임으로)
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        viewer.blocked = true;
+                    else if (errno != EINTR)
+                        failed = true;
+                    break;
+                }
+                viewer.nextSeq++;
+            }
+            if (failed)
+                closeViewer(i);
+            else
+                i++;
+        }
+        unpin();
+    }
+
+    void serve()
+    {
+        std::vector<pollfd> polls;
+        polls.reserve(MAX_VIEWERS + 2);
+        while (!listener.isStopping())
+        {
+            polls.clear();
+            polls.push_back({listener.getFd(), POLLIN, 0});
+            polls.push_back({wakeFds[0], POLLIN, 0});
+            for (const Viewer &viewer : viewers)
+                polls.push_back({viewer.fd, static_cast<short>(viewer.blocked ? POLLOUT : 0), 0});
+
+            if (poll(polls.data(), polls.size(), UnixListener::POLL_MILLIS) <= 0)
+                continue;
+
+            if (polls[1].revents & POLLIN)
+            {
+                char drain[64];
+                while (read(wakeFds[0], drain, sizeof(drain)) > 0)
+                {
+                }
+            }
+
+            // 끊긴 관전자 정리 (뒤에서부터: closeViewer 가 마지막 원소를 옮겨 옴)
+            for (size_t i = viewers.size(); i-- > 0;)
+            {
+                if (polls[i + 2].revents & (POLLHUP | POLLERR | POLLNVAL))
+                    closeViewer(i);
+            }
+            if (polls[0].revents & POLLIN)
+                acceptViewers();
+            sendPending();
+        }
+    }
+
+public:
+    SpectatorFeed() : wakeFds{-1, -1}, ring{}, freeCount(0), head(0), latestKeySeq(0), spare(nullptr),
+                      sinceKeyframe(0), pinned(nullptr), published(0), viewerSkips(0), viewerCount(0) {}
+    ~SpectatorFeed() { stop(); }
+
+    // path 가 비어 있거나 nullptr 이면 아무것도 하지 않음
+    bool start(const char *path, int rows, int cols)
+    {
+        if (!path || !*path || listener.isRunning() || rows <= 0 || cols <= 0 || rows > 65535 || cols > 65535)
+            return false;
+        if (pipe2(wakeFds, O_CLOEXEC | O_NONBLOCK) != 0)
+            return false;
+
+        // 메시지 버퍼는 처음에 최대 크기로 잡아 두어 게임 중에는 할당하지 않음
+        size_t maxSize = maxMessageSize(rows, cols);
+        freeCount = 0;
+        for (Buffer &buffer : buffers)
+        {
+            buffer.bytes.clear();
+            buffer.bytes.reserve(maxSize);
+            buffer.pins = 0;
+            buffer.inRing = false;
+            freeBuffers[freeCount++] = &buffer;
+        }
+        for (Buffer *&slot : ring)
+            slot = nullptr;
+        spare = freeBuffers[--freeCount];
+        pinned = nullptr;
+        sent.reset(new FrameBuffer(rows, cols));
+        viewers.reserve(MAX_VIEWERS);
+        head = 0;
+        latestKeySeq = 0;
+        sinceKeyframe = 0;
+
+        if (!listener.start(path, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 64, [this]()
+                            { serve(); }))
+        {
+            close(wakeFds[0]);
+            close(wakeFds[1]);
+            wakeFds[0] = wakeFds[1] = -1;
+            return false;
+        }
+        return true;
+    }
+
+    void stop()
+    {
+        if (!listener.isRunning())
+            return;
+        listener.stop();
+        for (const Viewer &viewer : viewers)
+            close(viewer.fd);
+        viewers.clear();
+        viewerCount.store(0, std::memory_order_relaxed);
+        close(wakeFds[0]);
+        close(wakeFds[1]);
+        wakeFds[0] = wakeFds[1] = -1;
+    }
+
+    bool isRunning() const { return listener.isRunning(); }
+
+    // 게임 스레드: 화면에 내보낸 프레임을 관전자용으로 올림 (바뀐 칸이 없으면 아무것도 안 함)
+    void publish(const FrameBuffer &frame)
+    {
+        if (!listener.isRunning() || frame.getHeight() != sent->getHeight() || frame.getWidth() != sent->getWidth())
+            return;
+
+        // head 는 게임 스레드만 바꾸므로 잠금 없이 읽음, spare 는 아직 링 밖이라 다른 스레드가 보지 않음
+        bool keyframe = head == 0 || sinceKeyframe + 1 >= KEYFRAME_INTERVAL;
+        if (encode(frame, keyframe, spare->bytes) == 0)
+            return;
+        uint32_t seq = static_cast<uint32_t>(head);
+        memcpy(spare->bytes.data() + offsetof(SpectatorHeader, seq), &seq, sizeof(seq));
+
+        std::unique_lock<std::mutex> lock(ringMutex);
+        Buffer *&slot = ring[head % RING_SLOTS];
+        if (slot)
+        {
+            // 밀려난 버퍼: 보내는 중이면 방송 스레드가 핀을 뺄 때 빈 목록으로 돌려 놓음
+            slot->inRing = false;
+            if (slot->pins == 0)
+                freeBuffers[freeCount++] = slot;
+        }
+        slot = spare;
+        slot->inRing = true;
+        spare = freeBuffers[--freeCount];
+        if (keyframe)
+        {
+            latestKeySeq = head;
+            sinceKeyframe = 0;
+        }
+        else
+        {
+            sinceKeyframe++;
+        }
+        head++;
+        lock.unlock();
+
+        *sent = frame;
+        published.fetch_add(1, std::memory_order_relaxed);
+        char wake = 1;
+        if (write(wakeFds[1], &wake, 1) < 0)
+        {
+            // 알림 파이프가 차 있으면 방송 스레드가 이미 깨어날 예정
+        }
+    }
+
+    uint64_t getPublished() const { return published.load(std::memory_order_relaxed); }
+    uint64_t getViewerSkips() const { return viewerSkips.load(std::memory_order_relaxed); }
+    int getViewerCount() const { return viewerCount.load(std::memory_order_relaxed); }
+};
+
+#endif // SPECTATORFEED_H
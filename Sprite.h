@@ -0,0 +1,70 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <vector>
+#include "RenderTarget.h"
+
+// Sprite: 미리 그려 둔 그림 한 장 (큰 눈사람, 모은 눈사람 판, 패널 테두리처럼 바뀌지 않는 글자)
+// - 만들 때 한 번 text() 로 글자와 속성(COLOR_PAIR | A_BOLD ...)을 chtype 배열에 구워 둠
+// - draw() 는 줄마다 글자를 쓴 구간만 putCells() (mvwaddchnstr) 로 그대로 복사 (printf 형식 해석, 속성 켜고 끄기 없음)
+// - 언제 다시 그릴지는 쓰는 쪽이 정함 (PlayScreen 은 패널 상태가 바뀔 때만)
+class Sprite
+{
+private:
+    int rows;
+    int cols;
+    std::vector<chtype> cells;
+    std::vector<int> spanStart; // 줄마다 글자를 쓴 구간 [spanStart, spanEnd) (안 쓴 줄은 spanStart >= spanEnd)
+    std::vector<int> spanEnd;
+
+public:
+    Sprite() : Sprite(1, 1) {}
+
+    Sprite(int spriteRows, int spriteCols)
+        : rows(spriteRows > 0 ? spriteRows : 1), cols(spriteCols > 0 ? spriteCols : 1),
+          cells(static_cast<size_t>(rows) * cols, static_cast<chtype>(' ')),
+          spanStart(static_cast<size_t>(rows), cols), spanEnd(static_cast<size_t>(rows), 0)
+    {
+    }
+
+    // (y, x) 부터 글자를 속성과 함께 구워 넣음 (그림 밖으로 나가는 부분은 버림)
+    Sprite &text(int y, int x, const char *glyphs, attr_t attrs = A_NORMAL)
+    {
+        if (y < 0 || y >= rows)
+        {
+            return *this;
+        }
+        for (int col = x; *glyphs != '\0'; glyphs++, col++)
+        {
+            if (col < 0 || col >= cols)
+            {
+                continue;
+            }
+            cells[static_cast<size_t>(y) * cols + col] = static_cast<chtype>(static_cast<unsigned char>(*glyphs)) | attrs;
+            if (col < spanStart[static_cast<size_t>(y)])
+                spanStart[static_cast<size_t>(y)] = col;
+            if (col + 1 > spanEnd[static_cast<size_t>(y)])
+                spanEnd[static_cast<size_t>(y)] = col + 1;
+        }
+        return *this;
+    }
+
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+
+    // (top, left) 에 그림 (쓴 구간 사이의 빈칸은 속성 없는 공백으로 덮음)
+    void draw(RenderTarget &target, int top = 0, int left = 0) const
+    {
+        for (int y = 0; y < rows; y++)
+        {
+            int start = spanStart[static_cast<size_t>(y)];
+            int end = spanEnd[static_cast<size_t>(y)];
+            if (start < end)
+            {
+                target.putCells(top + y, left + start, &cells[static_cast<size_t>(y) * cols + start], end - start);
+            }
+        }
+    }
+};
+
+#endif // SPRITE_H
@@ -0,0 +1,30 @@
+#ifndef STRINGUTIL_H
+#define STRINGUTIL_H
+
+#include <cctype>
+#include <string_view>
+
+// 대소문자 구분 없는 비교 (복사본을 만들지 않으므로 프레임/키 입력 경로에서 써도 힙을 쓰지 않음)
+inline bool equalsIgnoreCase(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// text 가 prefix 로 시작하는지 (대소문자 구분 없음)
+inline bool startsWithIgnoreCase(std::string_view text, std::string_view prefix)
+{
+    return text.size() >= prefix.size() && equalsIgnoreCase(text.substr(0, prefix.size()), prefix);
+}
+
+#endif // STRINGUTIL_H
@@ -0,0 +1,437 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// TimerWheel: 계층형 타이머 휠 (밀리초 단위)
+// - 0단: 256칸 x 1ms, 1~3단: 64칸씩 (256ms, 16.4초, 17.5분 단위) -> 약 18.6시간까지 바로 넣음
+// - advance() 는 빈 칸을 비트맵으로 건너뛰므로 만료된 타이머 수 + 단 넘김(cascade) 만큼만 일함
+// - nextDeadline() 으로 다음 만료 시각을 알려 주어 이벤트 루프가 그때까지 잠들 수 있음
+// - 노드는 재사용하므로 처음 몇 개를 만든 뒤에는 힙을 쓰지 않음 (콜백은 작은 람다 권장)
+// - 콜백 안에서 같은 칸의 다른 타이머를 restart/cancel 해도 됨 (실행 중인 칸의 노드는 표시만 하고 칸을 다 돈 뒤 정리)
+class TimerWheel
+{
+public:
+    typedef uint64_t TimerId;
+    typedef std::function<void()> Callback;
+    static const TimerId NO_TIMER = 0;
+
+private:
+    static const int LEVEL0_BITS = 8;
+    static const int LEVEL0_SLOTS = 1 << LEVEL0_BITS;
+    static const int UPPER_BITS = 6;
+    static const int UPPER_SLOTS = 1 << UPPER_BITS;
+    static const int UPPER_LEVELS = 3;
+    static const int64_t MAX_DELTA = int64_t(1) << (LEVEL0_BITS + UPPER_LEVELS * UPPER_BITS);
+
+    struct Timer
+    {
+        int64_t expires = 0;
+        int64_t interval = 0; // 주기 (주기 타이머) 또는 처음 지연 (한 번 타이머, restart 용)
+        bool periodic = false;
+        bool inUse = false;
+        bool linked = false;
+        bool inFlight = false;  // 지금 실행 중인 칸에서 떼어 낸 노드 (리스트를 건드리지 않음)
+        bool cancelled = false; // 실행 중에 취소됨 (칸을 다 돈 뒤 해제)
+        bool rearmed = false;   // 실행 중에 restart 됨 (칸을 다 돈 뒤 새 만료 시각으로 다시 넣음)
+        uint32_t generation = 1;
+        int32_t prev = -1;
+        int32_t next = -1;
+        int32_t *head = nullptr; // 들어 있는 칸의 리스트 머리
+        Callback callback;
+    };
+
+    std::deque<Timer> pool; // deque: 콜백 실행 중에 타이머가 늘어나도 기존 노드 주소가 바뀌지 않음
+    int32_t freeList;
+    int64_t now;
+    int activeCount;
+
+    int32_t level0[LEVEL0_SLOTS];
+    uint64_t level0Bits[LEVEL0_SLOTS / 64];
+    int32_t upper[UPPER_LEVELS][UPPER_SLOTS];
+    uint64_t upperBits[UPPER_LEVELS];
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    static TimerId makeId(int32_t index, uint32_t generation)
+    {
+        return (static_cast<TimerId>(generation) << 32) | static_cast<uint32_t>(index + 1);
+    }
+
+    // id 가 가리키는 살아 있는 노드 번호 (없으면 -1)
+    int32_t find(TimerId id) const
+    {
+        int64_t index = static_cast<int64_t>(id & 0xffffffffu) - 1;
+        if (index < 0 || index >= static_cast<int64_t>(pool.size()))
+            return -1;
+        const Timer &timer = pool[static_cast<size_t>(index)];
+        if (!timer.inUse || timer.cancelled || timer.generation != static_cast<uint32_t>(id >> 32))
+            return -1;
+        return static_cast<int32_t>(index);
+    }
+
+    void link(int32_t index)
+    {
+        Timer &timer = pool[static_cast<size_t>(index)];
+        int64_t delta = timer.expires - now;
+        int32_t *head;
+        if (delta < 0)
+        {
+            // 이미 지난 시각: 다음 1ms 칸 (delta == 0 은 단 넘김 직후의 현재 칸이라 바로 실행됨)
+            int slot = static_cast<int>((now + 1) & (LEVEL0_SLOTS - 1));
+            head = &level0[slot];
+            level0Bits[slot / 64] |= uint64_t(1) << (slot % 64);
+        }
+        else if (delta < LEVEL0_SLOTS)
+        {
+            int slot = static_cast<int>(timer.expires & (LEVEL0_SLOTS - 1));
+            head = &level0[slot];
+            level0Bits[slot / 64] |= uint64_t(1) << (slot % 64);
+        }
+        else
+        {
+            int64_t expires = delta < MAX_DELTA ? timer.expires : now + MAX_DELTA - 1;
+            int level = 0;
+            while (level < UPPER_LEVELS - 1 && delta >= (int64_t(1) << (LEVEL0_BITS + (level + 1) * UPPER_BITS)))
+            {
+                level++;
+            }
+            int slot = static_cast<int>((expires >> (LEVEL0_BITS + level * UPPER_BITS)) & (UPPER_SLOTS - 1));
+            head = &upper[level][slot];
+            upperBits[level] |= uint64_t(1) << slot;
+        }
+
+        timer.head = head;
+        timer.prev = -1;
+        timer.next = *head;
+        if (*head >= 0)
+            pool[static_cast<size_t>(*head)].prev = index;
+        *head = index;
+        timer.linked = true;
+    }
+
+    void unlink(int32_t index)
+    {
+        Timer &timer = pool[static_cast<size_t>(index)];
+        if (!timer.linked)
+            return;
+        if (timer.prev >= 0)
+            pool[static_cast<size_t>(timer.prev)].next = timer.next;
+        else
+            *timer.head = timer.next;
+        if (timer.next >= 0)
+            pool[static_cast<size_t>(timer.next)].prev = timer.prev;
+        if (*timer.head < 0)
+            clearBit(timer.head);
+        timer.linked = false;
+        timer.head = nullptr;
+        timer.prev = timer.next = -1;
+    }
+
+    // 비어 버린 칸의 비트 끄기
+    void clearBit(int32_t *head)
+    {
+        if (head >= level0 && head < level0 + LEVEL0_SLOTS)
+        {
+            int slot = static_cast<int>(head - level0);
+            level0Bits[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+            return;
+        }
+        for (int level = 0; level < UPPER_LEVELS; level++)
+        {
+            if (head >= upper[level] && head < upper[level] + UPPER_SLOTS)
+            {
+                upperBits[level] &= ~(uint64_t(1) << (head - upper[level]));
+                return;
+            }
+        }
+    }
+
+    // 칸의 리스트를 통째로 떼어 냄
+    int32_t detach(int32_t *head)
+    {
+        int32_t first = *head;
+        *head = -1;
+        clearBit(head);
+        for (int32_t i = first; i >= 0; i = pool[static_cast<size_t>(i)].next)
+        {
+            pool[static_cast<size_t>(i)].linked = false;
+            pool[static_cast<size_t>(i)].head = nullptr;
+        }
+        return first;
+    }
+
+    void release(int32_t index)
+    {
+        Timer &timer = pool[static_cast<size_t>(index)];
+        timer.callback = nullptr;
+        timer.inUse = false;
+        timer.inFlight = false;
+        timer.cancelled = false;
+        timer.rearmed = false;
+        timer.generation++;
+        timer.next = freeList;
+        freeList = index;
+        activeCount--;
+    }
+
+    // 윗단 칸 하나를 현재 시각 기준으로 다시 넣음
+    void cascade(int level, int slot)
+    {
+        int32_t i = detach(&upper[level][slot]);
+        while (i >= 0)
+        {
+            int32_t next = pool[static_cast<size_t>(i)].next;
+            link(i);
+            i = next;
+        }
+    }
+
+    // 0단 칸 하나의 타이머 실행
+    // 떼어 낸 리스트는 칸을 다 돌 때까지 next 를 바꾸지 않음: 콜백이 이 리스트의 노드를 restart/cancel 하면
+    // rearmed/cancelled 표시만 하고, 두 번째 바퀴에서 다시 넣거나 해제한다.
+    int runSlot(int slot, int64_t target)
+    {
+        int fired = 0;
+        int32_t first = detach(&level0[slot]);
+        for (int32_t i = first; i >= 0; i = pool[static_cast<size_t>(i)].next)
+        {
+            pool[static_cast<size_t>(i)].inFlight = true;
+        }
+
+        for (int32_t i = first; i >= 0; i = pool[static_cast<size_t>(i)].next)
+        {
+            Timer &timer = pool[static_cast<size_t>(i)];
+            if (timer.cancelled || timer.rearmed)
+                continue; // 앞 콜백이 취소했거나 다른 시각으로 미룸
+
+            if (timer.periodic)
+            {
+                // 밀린 주기는 한꺼번에 몰아서 실행하지 않고 건너뜀
+                timer.expires += timer.interval;
+                if (timer.expires <= target)
+                    timer.expires = target + timer.interval;
+            }
+            timer.callback();
+            fired++;
+        }
+
+        int32_t i = first;
+        while (i >= 0)
+        {
+            Timer &timer = pool[static_cast<size_t>(i)];
+            int32_t next = timer.next;
+            timer.inFlight = false;
+            if (timer.cancelled || (!timer.periodic && !timer.rearmed))
+            {
+                release(i);
+            }
+            else
+            {
+                timer.rearmed = false;
+                link(i);
+            }
+            i = next;
+        }
+        return fired;
+    }
+
+    // 현재 0단 창 안에서 now 이후 첫 번째로 차 있는 칸 (없으면 -1)
+    int nextLevel0Slot() const
+    {
+        int from = static_cast<int>(now & (LEVEL0_SLOTS - 1)) + 1;
+        for (int word = from / 64; word < LEVEL0_SLOTS / 64; word++)
+        {
+            uint64_t bits = level0Bits[word];
+            if (word == from / 64)
+                bits &= (from % 64) ? ~((uint64_t(1) << (from % 64)) - 1) : ~uint64_t(0);
+            if (bits)
+                return word * 64 + __builtin_ctzll(bits);
+        }
+        return -1;
+    }
+
+    int32_t allocate()
+    {
+        int32_t index;
+        if (freeList >= 0)
+        {
+            index = freeList;
+            freeList = pool[static_cast<size_t>(index)].next;
+        }
+        else
+        {
+            pool.emplace_back();
+            index = static_cast<int32_t>(pool.size() - 1);
+        }
+        Timer &timer = pool[static_cast<size_t>(index)];
+        timer.inUse = true;
+        timer.inFlight = false;
+        timer.cancelled = false;
+        timer.rearmed = false;
+        timer.prev = timer.next = -1;
+        activeCount++;
+        return index;
+    }
+
+    TimerId add(int64_t delayMillis, int64_t interval, bool periodic, Callback &&callback)
+    {
+        int32_t index = allocate();
+        Timer &timer = pool[static_cast<size_t>(index)];
+        timer.expires = now + (delayMillis > 0 ? delayMillis : 1);
+        timer.interval = interval > 0 ? interval : 1;
+        timer.periodic = periodic;
+        timer.callback = std::move(callback);
+        link(index);
+        return makeId(index, timer.generation);
+    }
+
+public:
+    explicit TimerWheel(int64_t startMillis) : freeList(-1), now(startMillis), activeCount(0)
+    {
+        for (int i = 0; i < LEVEL0_SLOTS; i++)
+            level0[i] = -1;
+        for (auto &bits : level0Bits)
+            bits = 0;
+        for (int level = 0; level < UPPER_LEVELS; level++)
+        {
+            for (int i = 0; i < UPPER_SLOTS; i++)
+                upper[level][i] = -1;
+            upperBits[level] = 0;
+        }
+    }
+
+    // delayMillis 뒤에 한 번 실행
+    TimerId schedule(int64_t delayMillis, Callback callback)
+    {
+        return add(delayMillis, delayMillis, false, std::move(callback));
+    }
+
+    // periodMillis 마다 실행 (첫 실행은 firstDelayMillis 뒤, 음수면 한 주기 뒤)
+    TimerId schedulePeriodic(int64_t periodMillis, Callback callback, int64_t firstDelayMillis = -1)
+    {
+        return add(firstDelayMillis >= 0 ? firstDelayMillis : periodMillis, periodMillis, true, std::move(callback));
+    }
+
+    // 취소 (이미 끝났거나 없는 타이머면 false)
+    bool cancel(TimerId id)
+    {
+        int32_t index = find(id);
+        if (index < 0)
+            return false;
+        if (pool[static_cast<size_t>(index)].inFlight)
+        {
+            pool[static_cast<size_t>(index)].cancelled = true; // 칸을 다 돈 뒤 해제
+            return true;
+        }
+        unlink(index);
+        release(index);
+        return true;
+    }
+
+    // 지금부터 다시 시작 (delayMillis 가 음수면 원래 주기/지연 사용)
+    bool restart(TimerId id, int64_t delayMillis = -1)
+    {
+        int32_t index = find(id);
+        if (index < 0)
+            return false;
+        Timer &timer = pool[static_cast<size_t>(index)];
+        int64_t delay = delayMillis >= 0 ? delayMillis : timer.interval;
+        timer.expires = now + (delay > 0 ? delay : 1);
+        if (timer.inFlight)
+        {
+            timer.rearmed = true; // 칸을 다 돈 뒤 다시 넣음
+            return true;
+        }
+        unlink(index);
+        link(index);
+        return true;
+    }
+
+    bool isPending(TimerId id) const
+    {
+        int32_t index = find(id);
+        if (index < 0)
+            return false;
+        const Timer &timer = pool[static_cast<size_t>(index)];
+        return timer.linked || (timer.inFlight && (timer.periodic || timer.rearmed));
+    }
+
+    // nowMillis 까지 시간을 진행하며 만료된 타이머 실행 (실행한 개수 반환)
+    int advance(int64_t nowMillis)
+    {
+        int fired = 0;
+        while (now < nowMillis)
+        {
+            // 다음으로 할 일이 있는 시각: 0단의 차 있는 칸 또는 0단 창의 끝(윗단 내리기)
+            int slot = nextLevel0Slot();
+            int64_t windowStart = now & ~static_cast<int64_t>(LEVEL0_SLOTS - 1);
+            int64_t next = slot >= 0 ? windowStart + slot : windowStart + LEVEL0_SLOTS;
+            if (next > nowMillis)
+            {
+                now = nowMillis;
+                break;
+            }
+
+            now = next;
+            if ((now & (LEVEL0_SLOTS - 1)) == 0)
+            {
+                // 창이 바뀜: 윗단의 해당 칸을 아래로 내림 (상위 단은 아래 단이 한 바퀴 돌았을 때만)
+                for (int level = 0; level < UPPER_LEVELS; level++)
+                {
+                    int index = static_cast<int>((now >> (LEVEL0_BITS + level * UPPER_BITS)) & (UPPER_SLOTS - 1));
+                    cascade(level, index);
+                    if (index != 0)
+                        break;
+                }
+            }
+            fired += runSlot(static_cast<int>(now & (LEVEL0_SLOTS - 1)), nowMillis);
+        }
+        return fired;
+    }
+
+    // 가장 이른 만료 시각 (타이머가 없으면 INT64_MAX)
+    int64_t nextDeadline() const
+    {
+        int slot = nextLevel0Slot();
+        int64_t windowStart = now & ~static_cast<int64_t>(LEVEL0_SLOTS - 1);
+        if (slot >= 0)
+            return windowStart + slot;
+
+        int64_t best = INT64_MAX;
+        // 0단에서 현재 위치 이전 칸은 다음 창에 속함
+        for (int word = 0; word < LEVEL0_SLOTS / 64 && best == INT64_MAX; word++)
+        {
+            if (level0Bits[word])
+                best = windowStart + LEVEL0_SLOTS + word * 64 + __builtin_ctzll(level0Bits[word]);
+        }
+        // 윗단: 현재 칸 다음부터 돌면서 처음 차 있는 칸의 가장 이른 타이머
+        for (int level = 0; level < UPPER_LEVELS; level++)
+        {
+            if (!upperBits[level])
+                continue;
+            int current = static_cast<int>((now >> (LEVEL0_BITS + level * UPPER_BITS)) & (UPPER_SLOTS - 1));
+            for (int step = 1; step <= UPPER_SLOTS; step++)
+            {
+                int index = (current + step) & (UPPER_SLOTS - 1);
+                if (!(upperBits[level] & (uint64_t(1) << index)))
+                    continue;
+                for (int32_t i = upper[level][index]; i >= 0; i = pool[static_cast<size_t>(i)].next)
+                {
+                    if (pool[static_cast<size_t>(i)].expires < best)
+                        best = pool[static_cast<size_t>(i)].expires;
+                }
+                break;
+            }
+        }
+        return best;
+    }
+
+    int64_t getNow() const { return now; }
+    int getActiveCount() const { return activeCount; }
+};
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,335 @@
+#ifndef TOKENIZER_H
+#define TOKENIZER_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SNOWMAN_TOKENIZER_AVX2 1
+#endif
+
+// TokenTable: 문장을 단어로 나눈 결과 (Dictionary::splitSentenceIntoWords 와 같은 규칙)
+// - 공백(' ', \t \n \v \f \r)으로 나누고 . , ! ? 를 지움, 다 지워져서 빈 단어는 버림
+// - 지운 단어 글자는 chars 하나에 이어 붙이고, 단어마다 원문 위치와 chars 위치만 Token 으로 남김 (단어마다 할당 없음)
+// - tokenize() 는 뒤에 덧붙이므로 clear() 후 다시 쓰면 용량을 그대로 재사용
+//
+// 두 단계로 나눔 (simdjson 과 같은 방식)
+// 1. 분류: 64바이트 블록마다 "공백인 바이트", "지울 문장부호인 바이트" 비트마스크를 만듦
+//    AVX2(32바이트 x2) / SSE2(16바이트 x4) / 스칼라 중 CPU 가 지원하는 것 (AVX2 는 실행 중에 확인)
+// 2. 경계: 공백 마스크가 바뀌는 비트만 ctz 로 훑어 단어 시작/끝을 찾고,
+//    단어 안 문장부호 수는 popcount 로 셈 (문장부호가 없는 단어는 memcpy 한 번)
+class TokenTable
+{
+public:
+    struct Token
+    {
+        uint32_t sourceOffset; // tokenize() 에 넘긴 원문에서 단어(문장부호 포함) 시작 위치
+        uint32_t sourceLength;
+        uint32_t offset; // chars 안에서 문장부호를 지운 단어 위치
+        uint32_t length;
+    };
+
+    enum Kernel
+    {
+        KERNEL_SCALAR,
+        KERNEL_SSE2,
+        KERNEL_AVX2
+    };
+
+private:
+    static const int BLOCK_BYTES = 64;
+    static const int BATCH_BLOCKS = 64; // 분류를 한 번에 하는 블록 수 (4KB, 마스크는 스택에)
+    static const int COPY_SLACK = 16;
+
+    std::pmr::vector<char> chars;
+    std::pmr::vector<Token> tokens;
+    size_t droppedCount; // 문장부호만 있어서 버린 단어 수 (clear() 이후)
+
+    static bool isSpace(unsigned char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+    static bool isStripped(unsigned char c) { return c == '.' || c == ',' || c == '!' || c == '?'; }
+
+    static void classifyScalar(const char *data, size_t blocks, uint64_t *space, uint64_t *strip)
+    {
+        for (size_t b = 0; b < blocks; b++)
+        {
+            uint64_t s = 0;
+            uint64_t p = 0;
+            const unsigned char *block = reinterpret_cast<const unsigned char *>(data) + b * BLOCK_BYTES;
+            for (int i = 0; i < BLOCK_BYTES; i++)
+            {
+                s |= static_cast<uint64_t>(isSpace(block[i])) << i;
+                p |= static_cast<uint64_t>(isStripped(block[i])) << i;
+            }
+            space[b] = s;
+            strip[b] = p;
+        }
+    }
+
+#if defined(__SSE2__)
+    static void classifySse2(const char *data, size_t blocks, uint64_t *space, uint64_t *strip)
+    {
+        const __m128i blank = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i four = _mm_set1_epi8(4); // \t..\r 는 '\t' 를 빼면 0..4
+        const __m128i period = _mm_set1_epi8('.');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i bang = _mm_set1_epi8('!');
+        const __m128i question = _mm_set1_epi8('?');
+        for (size_t b = 0; b < blocks; b++)
+        {
+            uint64_t s = 0;
+            uint64_t p = 0;
+            for (int part = 0; part < 4; part++)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + b * BLOCK_BYTES + part * 16));
+                __m128i control = _mm_sub_epi8(v, tab);
+                __m128i isSpaceByte = _mm_or_si128(_mm_cmpeq_epi8(v, blank),
+                                                   _mm_cmpeq_epi8(_mm_min_epu8(control, four), control));
+                __m128i isStripByte = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, period), _mm_cmpeq_epi8(v, comma)),
+                                                   _mm_or_si128(_mm_cmpeq_epi8(v, bang), _mm_cmpeq_epi8(v, question)));
+                s |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(isSpaceByte))) << (part * 16);
+                p |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(isStripByte))) << (part * 16);
+            }
+            space[b] = s;
+            strip[b] = p;
+        }
+    }
+#endif
+
+#if defined(SNOWMAN_TOKENIZER_AVX2)
+    __attribute__((target("avx2"))) static void classifyAvx2(const char *data, size_t blocks, uint64_t *space, uint64_t *strip)
+    {
+        const __m256i blank = _mm256_set1_epi8(' ');
+        const __m256i tab = _mm256_set1_epi8('\t');
+        const __m256i four = _mm256_set1_epi8(4);
+        const __m256i period = _mm256_set1_epi8('.');
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i bang = _mm256_set1_epi8('!');
+        const __m256i question = _mm256_set1_epi8('?');
+        for (size_t b = 0; b < blocks; b++)
+        {
+            uint64_t s = 0;
+            uint64_t p = 0;
+            for (int part = 0; part < 2; part++)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + b * BLOCK_BYTES + part * 32));
+                __m256i control = _mm256_sub_epi8(v, tab);
+                __m256i isSpaceByte = _mm256_or_si256(_mm256_cmpeq_epi8(v, blank),
+                                                      _mm256_cmpeq_epi8(_mm256_min_epu8(control, four), control));
+                __m256i isStripByte = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, period), _mm256_cmpeq_epi8(v, comma)),
+                                                      _mm256_or_si256(_mm256_cmpeq_epi8(v, bang), _mm256_cmpeq_epi8(v, question)));
+                s |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(isSpaceByte))) << (part * 32);
+                p |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(isStripByte))) << (part * 32);
+            }
+            space[b] = s;
+            strip[b] = p;
+        }
+    }
+#endif
+
+    static void classify(Kernel kernel, const char *data, size_t blocks, uint64_t *space, uint64_t *strip)
+    {
+#if defined(SNOWMAN_TOKENIZER_AVX2)
+        if (kernel == KERNEL_AVX2)
+        {
+            classifyAvx2(data, blocks, space, strip);
+            return;
+        }
+#endif
+#if defined(__SSE2__)
+        if (kernel != KERNEL_SCALAR)
+        {
+            classifySse2(data, blocks, space, strip);
+            return;
+        }
+#endif
+        classifyScalar(data, blocks, space, strip);
+    }
+
+    // 2단계에서 블록 사이로 넘겨야 하는 상태
+    struct ScanState
+    {
+        uint64_t previousSpace = 1; // 바로 앞 바이트가 공백이었는지 (원문 앞은 공백으로 봄)
+        size_t strippedBefore = 0;  // 지금 블록 앞까지 나온 문장부호 수
+        size_t wordStart = 0;
+        size_t wordStripped = 0; // 단어 시작 위치 앞까지 나온 문장부호 수
+    };
+
+    void emit(const char *source, size_t sourceSize, size_t begin, size_t end, size_t stripped, char *&out)
+    {
+        size_t length = end - begin - stripped;
+        if (length == 0)
+        {
+            droppedCount++;
+            return;
+        }
+        char *word = out;
+        if (stripped == 0)
+        {
+            // 16바이트씩 통째로 복사 (단어 뒤에 더 쓴 바이트는 다음 단어가 덮어씀, chars 끝에는 COPY_SLACK 만큼 여유)
+            if (begin + length + COPY_SLACK <= sourceSize)
+            {
+                for (size_t i = 0; i < length; i += COPY_SLACK)
+                {
+                    memcpy(out + i, source + begin + i, COPY_SLACK);
+                }
+            }
+            else
+            {
+                memcpy(out, source + begin, length);
+            }
+            out += length;
+        }
+        else
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                *out = source[i];
+                out += !isStripped(static_cast<unsigned char>(source[i]));
+            }
+        }
+        tokens.push_back(Token{static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin),
+                               static_cast<uint32_t>(word - chars.data()), static_cast<uint32_t>(length)});
+    }
+
+    void scanBlock(const char *source, size_t sourceSize, size_t base, uint64_t space, uint64_t strip, ScanState &state, char *&out)
+    {
+        // 공백 여부가 앞 바이트와 달라지는 자리 = 단어 시작(공백 아님) 또는 끝(공백)
+        uint64_t changes = space ^ ((space << 1) | state.previousSpace);
+        state.previousSpace = space >> (BLOCK_BYTES - 1);
+        while (changes != 0)
+        {
+            int bit = __builtin_ctzll(changes);
+            changes &= changes - 1;
+            size_t strippedHere = state.strippedBefore + __builtin_popcountll(strip & ((uint64_t(1) << bit) - 1));
+            if (((space >> bit) & 1) == 0)
+            {
+                state.wordStart = base + bit;
+                state.wordStripped = strippedHere;
+            }
+            else
+            {
+                emit(source, sourceSize, state.wordStart, base + bit, strippedHere - state.wordStripped, out);
+            }
+        }
+        state.strippedBefore += __builtin_popcountll(strip);
+    }
+
+public:
+    explicit TokenTable(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : chars(resource), tokens(resource), droppedCount(0) {}
+
+    // 이 CPU 에서 쓸 수 있는 가장 빠른 분류 방식
+    static Kernel bestKernel()
+    {
+#if defined(SNOWMAN_TOKENIZER_AVX2)
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        if (avx2)
+        {
+            return KERNEL_AVX2;
+        }
+#endif
+#if defined(__SSE2__)
+        return KERNEL_SSE2;
+#else
+        return KERNEL_SCALAR;
+#endif
+    }
+
+    // 이 빌드/CPU 에서 쓸 수 있는지 (안 되는 방식을 넘기면 tokenize 가 한 단계 아래 방식을 씀)
+    static bool isSupported(Kernel kernel)
+    {
+        return kernel <= bestKernel();
+    }
+
+    static const char *getKernelName(Kernel kernel)
+    {
+        switch (kernel)
+        {
+        case KERNEL_AVX2:
+            return "avx2";
+        case KERNEL_SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+        }
+    }
+
+    void clear()
+    {
+        chars.clear();
+        tokens.clear();
+        droppedCount = 0;
+    }
+
+    // textSize: 앞으로 tokenize() 에 넘길 원문 길이 합
+    void reserve(size_t textSize, size_t tokenCount)
+    {
+        chars.reserve(textSize + COPY_SLACK);
+        tokens.reserve(tokenCount);
+    }
+
+    // text 를 단어로 나눠 뒤에 덧붙임 (덧붙인 단어 수 반환, text 는 4GB 미만)
+    size_t tokenize(std::string_view text, Kernel kernel = bestKernel())
+    {
+        if (!isSupported(kernel))
+        {
+            kernel = bestKernel();
+        }
+        size_t firstToken = tokens.size();
+        size_t firstChar = chars.size();
+        chars.resize(firstChar + text.size() + COPY_SLACK); // 지운 단어는 원문보다 길 수 없음 (끝나고 줄임)
+        char *out = chars.data() + firstChar;
+
+        uint64_t space[BATCH_BLOCKS];
+        uint64_t strip[BATCH_BLOCKS];
+        ScanState state;
+        size_t fullBlocks = text.size() / BLOCK_BYTES;
+        for (size_t first = 0; first < fullBlocks; first += BATCH_BLOCKS)
+        {
+            size_t count = fullBlocks - first < BATCH_BLOCKS ? fullBlocks - first : BATCH_BLOCKS;
+            classify(kernel, text.data() + first * BLOCK_BYTES, count, space, strip);
+            for (size_t b = 0; b < count; b++)
+            {
+                scanBlock(text.data(), text.size(), (first + b) * BLOCK_BYTES, space[b], strip[b], state, out);
+            }
+        }
+
+        // 남은 바이트는 공백으로 채운 블록 하나로 (원문이 블록 크기의 배수여도 이 블록이 마지막 단어를 닫음)
+        char tail[BLOCK_BYTES];
+        size_t base = fullBlocks * BLOCK_BYTES;
+        memset(tail, ' ', sizeof(tail));
+        if (text.size() > base)
+        {
+            memcpy(tail, text.data() + base, text.size() - base);
+        }
+        classify(kernel, tail, 1, space, strip);
+        scanBlock(text.data(), text.size(), base, space[0], strip[0], state, out);
+
+        chars.resize(static_cast<size_t>(out - chars.data()));
+        return tokens.size() - firstToken;
+    }
+
+    size_t size() const { return tokens.size(); }
+    bool empty() const { return tokens.empty(); }
+    size_t getDroppedCount() const { return droppedCount; }
+    const Token &getToken(size_t i) const { return tokens[i]; }
+
+    // 문장부호를 지운 단어 (다음 tokenize() 전까지 유효)
+    std::string_view operator[](size_t i) const { return std::string_view(chars.data() + tokens[i].offset, tokens[i].length); }
+
+    // 문장부호를 지우기 전 원문 조각 (text 는 그 단어를 만든 tokenize() 에 넘긴 원문)
+    std::string_view getSource(std::string_view text, size_t i) const
+    {
+        return text.substr(tokens[i].sourceOffset, tokens[i].sourceLength);
+    }
+};
+
+#endif // TOKENIZER_H
@@ -0,0 +1,529 @@
+#ifndef TYPINGANALYTICS_H
+#define TYPINGANALYTICS_H
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "Histogram.h"
+
+// TypingAnalytics: 키 입력 흐름에서 타자 지표를 계속 갱신 (키 하나에 O(1), 고정 크기 배열만 사용)
+// - WPM: 맞게 친 글자 / 5 를 분 단위로 (세션 전체, 최근 WINDOW_SECONDS 초)
+// - 정확도: 맞게 친 글자 / 친 글자,  백스페이스 비율: 백스페이스 / 전체 키
+// - 단어 지연: 단어 블록이 처음 떨어지기 시작한 때부터 그 칸에 맞는 단어를 제출할 때까지 (Histogram)
+// - 글자별 오류: 쳐야 했던 글자 x 실제로 친 글자 (26 x 27, 마지막 칸은 글자가 아닌 것)
+// SNOWMAN_ANALYTICS_DIR 이 있으면 키 이벤트도 모아 두었다가 세션이 끝날 때 열 단위 로그로 씀 (writeLog)
+//
+// 로그 파일 (<dir>/typing-<pid>-<session>.snta, 리틀 엔디언):
+//   [LogHeader] [ColumnInfo x columnCount] [열 데이터...]
+//   열마다 따로 있어서 필요한 열만 읽으면 됨. 시간/지연은 LEB128 varint (시간은 앞 이벤트와의 차이)
+class TypingAnalytics
+{
+public:
+    static const int WINDOW_SECONDS = 60;
+    static const int LETTERS = 26;
+    static const int MAX_SLOTS = 16;
+    static const size_t EVENT_RESERVE = 8192; // 로그를 켜면 처음에 잡아 두는 이벤트 수
+
+    // 이벤트 코드: 출력 가능한 글자는 그 글자 그대로 (32~126)
+    enum Code : uint8_t
+    {
+        CODE_BACKSPACE = 8,
+        CODE_NEXT = 9,
+        CODE_SUBMIT = 10,
+        CODE_PREVIOUS = 11,
+    };
+
+    // 이벤트 플래그 (slot 과 한 바이트: 아래 4비트 칸 번호, 위 4비트 플래그)
+    enum Flag : uint8_t
+    {
+        FLAG_HIT = 1,      // 글자가 맞음 / 제출한 단어가 맞음
+        FLAG_MISS = 2,     // 글자가 틀림 / 제출한 단어가 틀림
+        FLAG_CREDITED = 4, // 이 라운드에서 그 단어를 처음 맞힘 (단어 지연 기록)
+        FLAG_UNCOUNTED = 8, // 타자 지표에서 뺀 글자 (칸이 가득 참, 아이템 명령 "random")
+    };
+
+    enum Column : uint32_t
+    {
+        COLUMN_TIME = 1,          // varint: 앞 이벤트와의 시간 차 (ms)
+        COLUMN_CODE = 2,          // u8
+        COLUMN_SLOT_FLAGS = 3,    // u8
+        COLUMN_WORD_SLOT = 4,     // u8: 맞힌 단어의 칸
+        COLUMN_WORD_LATENCY = 5,  // varint: 단어 지연 (ms)
+        COLUMN_LETTER_ERRORS = 6, // (expected u8, typed u8, varint count), 0 이 아닌 칸만
+        COLUMN_LETTER_COUNTS = 7, // varint x 26: 글자별로 쳐야 했던 횟수
+    };
+
+    struct LogHeader
+    {
+        char magic[4]; // "SNTA"
+        uint16_t version;
+        uint16_t level;
+        uint32_t pid;
+        uint32_t sessionId;
+        int64_t startMillis;
+        uint32_t durationMillis;
+        uint32_t columnCount;
+    };
+
+    struct ColumnInfo
+    {
+        uint32_t id;
+        uint32_t rows;
+        uint32_t offset; // 파일 처음부터
+        uint32_t size;
+    };
+
+    // 읽은 로그 (typing_report 등에서 사용)
+    struct Log
+    {
+        LogHeader header;
+        std::vector<uint32_t> eventMillis; // 세션 시작부터
+        std::vector<uint8_t> eventCodes;
+        std::vector<uint8_t> eventSlotFlags;
+        std::vector<uint8_t> wordSlots;
+        std::vector<uint32_t> wordLatencyMillis;
+        uint32_t letterErrors[LETTERS][LETTERS + 1];
+        uint32_t letterCounts[LETTERS];
+    };
+
+private:
+    int64_t startMillis;
+    int64_t lastMillis;
+
+    // 누적
+    uint64_t keys;
+    uint64_t typedChars;
+    uint64_t correctChars;
+    uint64_t backspaces;
+    uint64_t wordsSubmitted;
+    uint64_t wordsCorrect;
+    Histogram wordLatencyMillis;
+    uint32_t letterErrors[LETTERS][LETTERS + 1];
+    uint32_t letterCounts[LETTERS];
+
+    // 최근 WINDOW_SECONDS 초 (초 단위 칸을 돌려 씀)
+    uint32_t windowTyped[WINDOW_SECONDS];
+    uint32_t windowCorrect[WINDOW_SECONDS];
+    uint64_t windowTypedSum;
+    uint64_t windowCorrectSum;
+    int64_t windowSecond; // windowTyped 의 마지막 칸이 나타내는 초
+
+    bool credited[MAX_SLOTS]; // 이번 라운드에서 이미 맞힌 칸
+
+    // 로그 (logging 일 때만)
+    bool logging;
+    std::vector<uint8_t> timeColumn;
+    std::vector<uint8_t> codeColumn;
+    std::vector<uint8_t> slotFlagsColumn;
+    std::vector<uint8_t> wordSlotColumn;
+    std::vector<uint8_t> wordLatencyColumn;
+    int64_t lastEventMillis;
+
+    static int letterIndex(char c)
+    {
+        unsigned char lower = static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c)));
+        return lower >= 'a' && lower <= 'z' ? lower - 'a' : -1;
+    }
+
+    static void putVarint(std::vector<uint8_t> &out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    static bool getVarint(const uint8_t *&data, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && data < end; shift += 7)
+        {
+            uint8_t byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    // 시계를 now 의 초까지 돌리면서 지난 칸을 비움 (한 번에 최대 WINDOW_SECONDS 칸)
+    void advanceWindow(int64_t now)
+    {
+        int64_t second = (now - startMillis) / 1000;
+        if (second <= windowSecond)
+            return;
+        if (second - windowSecond >= WINDOW_SECONDS)
+        {
+            memset(windowTyped, 0, sizeof(windowTyped));
+            memset(windowCorrect, 0, sizeof(windowCorrect));
+            windowTypedSum = 0;
+            windowCorrectSum = 0;
+        }
+        else
+        {
+            for (int64_t s = windowSecond + 1; s <= second; s++)
+            {
+                int index = static_cast<int>(s % WINDOW_SECONDS);
+                windowTypedSum -= windowTyped[index];
+                windowCorrectSum -= windowCorrect[index];
+                windowTyped[index] = 0;
+                windowCorrect[index] = 0;
+            }
+        }
+        windowSecond = second;
+    }
+
+    void countKey(int64_t now)
+    {
+        keys++;
+        if (now > lastMillis)
+            lastMillis = now;
+        advanceWindow(now);
+    }
+
+    void logEvent(int64_t now, uint8_t code, int slot, uint8_t flags)
+    {
+        if (!logging)
+            return;
+        putVarint(timeColumn, static_cast<uint64_t>(now > lastEventMillis ? now - lastEventMillis : 0));
+        if (now > lastEventMillis)
+            lastEventMillis = now;
+        codeColumn.push_back(code);
+        slotFlagsColumn.push_back(static_cast<uint8_t>((slot & 15) | (flags << 4)));
+    }
+
+    static double perMinute(uint64_t chars, double millis)
+    {
+        // 1초 미만이면 1초로 보아 첫 키에서 값이 튀지 않게 함
+        return millis < 1000.0 ? chars / 5.0 * 60.0 : chars / 5.0 * 60000.0 / millis;
+    }
+
+public:
+    explicit TypingAnalytics(int64_t sessionStartMillis, bool keepLog = false)
+        : startMillis(sessionStartMillis), lastMillis(sessionStartMillis), keys(0), typedChars(0), correctChars(0),
+          backspaces(0), wordsSubmitted(0), wordsCorrect(0), windowTypedSum(0), windowCorrectSum(0), windowSecond(0),
+          logging(keepLog), lastEventMillis(sessionStartMillis)
+    {
+        memset(letterErrors, 0, sizeof(letterErrors));
+        memset(letterCounts, 0, sizeof(letterCounts));
+        memset(windowTyped, 0, sizeof(windowTyped));
+        memset(windowCorrect, 0, sizeof(windowCorrect));
+        memset(credited, 0, sizeof(credited));
+        if (logging)
+        {
+            timeColumn.reserve(EVENT_RESERVE * 2);
+            codeColumn.reserve(EVENT_RESERVE);
+            slotFlagsColumn.reserve(EVENT_RESERVE);
+            wordSlotColumn.reserve(256);
+            wordLatencyColumn.reserve(512);
+        }
+    }
+
+    // 새 라운드: 칸마다 "이미 맞힘" 표시를 지움
+    void beginRound() { memset(credited, 0, sizeof(credited)); }
+
+    // 글자 키: expected 는 그 위치에 와야 했던 글자 (단어보다 길게 치면 0)
+    // counted 가 false 면 키 수만 세고 WPM/정확도/글자별 오류에는 넣지 않음
+    void onCharacter(int64_t now, int slot, char typed, char expected, bool counted)
+    {
+        countKey(now);
+        if (!counted)
+        {
+            logEvent(now, static_cast<uint8_t>(typed), slot, FLAG_UNCOUNTED);
+            return;
+        }
+        typedChars++;
+        int window = static_cast<int>(windowSecond % WINDOW_SECONDS);
+        windowTyped[window]++;
+        windowTypedSum++;
+
+        int expectedLetter = expected ? letterIndex(expected) : -1;
+        bool hit = expected && std::tolower(static_cast<unsigned char>(typed)) == std::tolower(static_cast<unsigned char>(expected));
+        if (expectedLetter >= 0)
+        {
+            letterCounts[expectedLetter]++;
+            if (!hit)
+            {
+                int typedLetter = letterIndex(typed);
+                if (typedLetter < 0)
+                    typedLetter = LETTERS; // 글자가 아닌 것
+                letterErrors[expectedLetter][typedLetter]++;
+            }
+        }
+        if (hit)
+        {
+            correctChars++;
+            windowCorrect[window]++;
+            windowCorrectSum++;
+        }
+        logEvent(now, static_cast<uint8_t>(typed), slot, static_cast<uint8_t>(hit ? FLAG_HIT : FLAG_MISS));
+    }
+
+    void onBackspace(int64_t now, int slot)
+    {
+        countKey(now);
+        backspaces++;
+        logEvent(now, CODE_BACKSPACE, slot, 0);
+    }
+
+    void onNavigate(int64_t now, int slot, bool forward)
+    {
+        countKey(now);
+        logEvent(now, forward ? CODE_NEXT : CODE_PREVIOUS, slot, 0);
+    }
+
+    // 칸 제출: spawnedAt 은 그 단어 블록이 처음 생긴 시각 (아직 안 생겼으면 0 -> 지연 기록 안 함)
+    void onSubmit(int64_t now, int slot, bool correct, int64_t spawnedAt)
+    {
+        countKey(now);
+        wordsSubmitted++;
+        uint8_t flags = static_cast<uint8_t>(correct ? FLAG_HIT : FLAG_MISS);
+        if (correct && slot >= 0 && slot < MAX_SLOTS && !credited[slot])
+        {
+            credited[slot] = true;
+            wordsCorrect++;
+            if (spawnedAt > 0 && now >= spawnedAt)
+            {
+                uint64_t latency = static_cast<uint64_t>(now - spawnedAt);
+                wordLatencyMillis.record(latency);
+                if (logging)
+                {
+                    wordSlotColumn.push_back(static_cast<uint8_t>(slot));
+                    putVarint(wordLatencyColumn, latency);
+                }
+            }
+            flags |= FLAG_CREDITED;
+        }
+        logEvent(now, CODE_SUBMIT, slot, flags);
+    }
+
+    // ===== 지표 =====
+    double getSessionWpm(int64_t now) const { return perMinute(correctChars, static_cast<double>(now - startMillis)); }
+    double getGrossWpm(int64_t now) const { return perMinute(typedChars, static_cast<double>(now - startMillis)); }
+
+    // 최근 WINDOW_SECONDS 초의 WPM (세션이 그보다 짧으면 지난 시간으로 나눔)
+    double getRollingWpm(int64_t now)
+    {
+        advanceWindow(now);
+        double span = static_cast<double>(now - startMillis);
+        if (span > WINDOW_SECONDS * 1000.0)
+            span = WINDOW_SECONDS * 1000.0;
+        return perMinute(windowCorrectSum, span);
+    }
+
+    double getRollingAccuracy(int64_t now)
+    {
+        advanceWindow(now);
+        return windowTypedSum ? static_cast<double>(windowCorrectSum) / windowTypedSum : 1.0;
+    }
+
+    double getAccuracy() const { return typedChars ? static_cast<double>(correctChars) / typedChars : 1.0; }
+    double getBackspaceRate() const { return keys ? static_cast<double>(backspaces) / keys : 0.0; }
+    uint64_t getKeys() const { return keys; }
+    uint64_t getTypedChars() const { return typedChars; }
+    uint64_t getCorrectChars() const { return correctChars; }
+    uint64_t getWordsCorrect() const { return wordsCorrect; }
+    uint64_t getWordsSubmitted() const { return wordsSubmitted; }
+    const Histogram &getWordLatencyMillis() const { return wordLatencyMillis; }
+    uint32_t getLetterCount(int letter) const { return letterCounts[letter]; }
+    uint32_t getLetterErrors(int expected, int typed) const { return letterErrors[expected][typed]; }
+    bool isLogging() const { return logging; }
+
+    // ===== 열 단위 로그 =====
+    // 세션이 끝날 때 한 번: <dir>/typing-<pid>-<sessionId>.snta
+    bool writeLog(const char *dir, int sessionId, int level) const
+    {
+        if (!logging || !dir || !*dir)
+            return false;
+
+        std::vector<uint8_t> letterErrorColumn;
+        uint32_t letterErrorRows = 0;
+        for (int expected = 0; expected < LETTERS; expected++)
+        {
+            for (int typed = 0; typed <= LETTERS; typed++)
+            {
+                if (letterErrors[expected][typed] == 0)
+                    continue;
+                letterErrorColumn.push_back(static_cast<uint8_t>(expected));
+                letterErrorColumn.push_back(static_cast<uint8_t>(typed));
+                putVarint(letterErrorColumn, letterErrors[expected][typed]);
+                letterErrorRows++;
+            }
+        }
+        std::vector<uint8_t> letterCountColumn;
+        for (int letter = 0; letter < LETTERS; letter++)
+            putVarint(letterCountColumn, letterCounts[letter]);
+
+        struct Source
+        {
+            uint32_t id;
+            uint32_t rows;
+            const std::vector<uint8_t> *bytes;
+        };
+        const uint32_t events = static_cast<uint32_t>(codeColumn.size());
+        const uint32_t words = static_cast<uint32_t>(wordSlotColumn.size());
+        const Source sources[] = {
+            {COLUMN_TIME, events, &timeColumn},
+            {COLUMN_CODE, events, &codeColumn},
+            {COLUMN_SLOT_FLAGS, events, &slotFlagsColumn},
+            {COLUMN_WORD_SLOT, words, &wordSlotColumn},
+            {COLUMN_WORD_LATENCY, words, &wordLatencyColumn},
+            {COLUMN_LETTER_ERRORS, letterErrorRows, &letterErrorColumn},
+            {COLUMN_LETTER_COUNTS, LETTERS, &letterCountColumn},
+        };
+        const uint32_t columnCount = sizeof(sources) / sizeof(sources[0]);
+
+        LogHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "SNTA", 4);
+        header.version = 1;
+        header.level = static_cast<uint16_t>(level);
+        header.pid = static_cast<uint32_t>(getpid());
+        header.sessionId = static_cast<uint32_t>(sessionId);
+        header.startMillis = startMillis;
+        header.durationMillis = static_cast<uint32_t>(lastMillis - startMillis);
+        header.columnCount = columnCount;
+
+        ColumnInfo infos[columnCount];
+        uint32_t offset = static_cast<uint32_t>(sizeof(header) + sizeof(infos));
+        for (uint32_t i = 0; i < columnCount; i++)
+        {
+            infos[i].id = sources[i].id;
+            infos[i].rows = sources[i].rows;
+            infos[i].offset = offset;
+            infos[i].size = static_cast<uint32_t>(sources[i].bytes->size());
+            offset += infos[i].size;
+        }
+
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/typing-%d-%d.snta", dir, static_cast<int>(getpid()), sessionId);
+        FILE *file = fopen(path, "wb");
+        if (!file)
+            return false;
+        bool ok = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(infos, sizeof(infos), 1, file) == 1;
+        for (uint32_t i = 0; i < columnCount && ok; i++)
+        {
+            const std::vector<uint8_t> &bytes = *sources[i].bytes;
+            ok = bytes.empty() || fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+        }
+        return fclose(file) == 0 && ok;
+    }
+
+    // 로그 파일 하나를 읽음 (모르는 열은 건너뜀). 실패하면 false 와 error
+    static bool readLog(const char *path, Log &log, std::string &error)
+    {
+        FILE *file = fopen(path, "rb");
+        if (!file)
+        {
+            error = std::string("cannot open ") + path;
+            return false;
+        }
+        std::vector<uint8_t> bytes;
+        uint8_t buffer[65536];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            bytes.insert(bytes.end(), buffer, buffer + count);
+        fclose(file);
+
+        if (bytes.size() < sizeof(LogHeader))
+        {
+            error = "file too short";
+            return false;
+        }
+        memcpy(&log.header, bytes.data(), sizeof(LogHeader));
+        if (memcmp(log.header.magic, "SNTA", 4) != 0 || log.header.version != 1 ||
+            sizeof(LogHeader) + static_cast<uint64_t>(log.header.columnCount) * sizeof(ColumnInfo) > bytes.size())
+        {
+            error = "not a typing log";
+            return false;
+        }
+
+        log.eventMillis.clear();
+        log.eventCodes.clear();
+        log.eventSlotFlags.clear();
+        log.wordSlots.clear();
+        log.wordLatencyMillis.clear();
+        memset(log.letterErrors, 0, sizeof(log.letterErrors));
+        memset(log.letterCounts, 0, sizeof(log.letterCounts));
+
+        for (uint32_t i = 0; i < log.header.columnCount; i++)
+        {
+            ColumnInfo info;
+            memcpy(&info, bytes.data() + sizeof(LogHeader) + i * sizeof(ColumnInfo), sizeof(info));
+            if (static_cast<uint64_t>(info.offset) + info.size > bytes.size())
+            {
+                error = "column out of range";
+                return false;
+            }
+            const uint8_t *data = bytes.data() + info.offset;
+            const uint8_t *end = data + info.size;
+            uint64_t value = 0;
+            bool ok = true;
+            switch (info.id)
+            {
+            case COLUMN_TIME:
+            {
+                uint64_t millis = 0;
+                for (uint32_t row = 0; row < info.rows && (ok = getVarint(data, end, value)); row++)
+                    log.eventMillis.push_back(static_cast<uint32_t>(millis += value));
+                break;
+            }
+            case COLUMN_CODE:
+                ok = info.size == info.rows;
+                log.eventCodes.assign(data, data + (ok ? info.size : 0));
+                break;
+            case COLUMN_SLOT_FLAGS:
+                ok = info.size == info.rows;
+                log.eventSlotFlags.assign(data, data + (ok ? info.size : 0));
+                break;
+            case COLUMN_WORD_SLOT:
+                ok = info.size == info.rows;
+                log.wordSlots.assign(data, data + (ok ? info.size : 0));
+                break;
+            case COLUMN_WORD_LATENCY:
+                for (uint32_t row = 0; row < info.rows && (ok = getVarint(data, end, value)); row++)
+                    log.wordLatencyMillis.push_back(static_cast<uint32_t>(value));
+                break;
+            case COLUMN_LETTER_ERRORS:
+                for (uint32_t row = 0; row < info.rows && ok; row++)
+                {
+                    ok = end - data >= 2 && data[0] < LETTERS && data[1] <= LETTERS;
+                    if (!ok)
+                        break;
+                    int expected = data[0];
+                    int typed = data[1];
+                    data += 2;
+                    if ((ok = getVarint(data, end, value)))
+                        log.letterErrors[expected][typed] = static_cast<uint32_t>(value);
+                }
+                break;
+            case COLUMN_LETTER_COUNTS:
+                for (int letter = 0; letter < LETTERS && (ok = getVarint(data, end, value)); letter++)
+                    log.letterCounts[letter] = static_cast<uint32_t>(value);
+                break;
+            default:
+                break; // 나중 버전에서 추가된 열
+            }
+            if (!ok)
+            {
+                error = "corrupt column " + std::to_string(info.id);
+                return false;
+            }
+        }
+        if (log.eventMillis.size() != log.eventCodes.size() || log.eventCodes.size() != log.eventSlotFlags.size() ||
+            log.wordSlots.size() != log.wordLatencyMillis.size())
+        {
+            error = "column lengths differ";
+            return false;
+        }
+        return true;
+    }
+};
+
+#endif // TYPINGANALYTICS_H
@@ -0,0 +1,264 @@
+#ifndef TYPISTBOT_H
+#define TYPISTBOT_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cctype>
+#include "GameSession.h"
+
+// TypistBot: 사람처럼 타자를 치는 가상 플레이어
+// - 화면에 떨어지는 WordBlock 중 가장 아래(급한) 단어부터 반응
+// - 반응 지연 후 WPM 에 맞는 간격으로 한 글자씩 InputHandler 에 키를 보냄
+// - 일정 확률로 오타를 내고, 일부는 알아채서 백스페이스로 고침
+// - 아이템 박스가 보이면 빈 칸에 "random" 을 입력해서 사용
+class TypistBot
+{
+public:
+    struct Profile
+    {
+        double wordsPerMinute; // 평균 타자 속도 (5타 = 1단어)
+        double typoRate;       // 한 글자마다 오타를 낼 확률
+        double correctionRate; // 오타를 알아채고 고칠 확률
+        int reactionMillis;    // 새 단어를 보고 치기 시작할 때까지의 지연
+        bool useItems;         // 아이템 박스 사용 여부
+
+        Profile() : wordsPerMinute(60.0), typoRate(0.03), correctionRate(0.8),
+                    reactionMillis(400), useItems(true) {}
+    };
+
+private:
+    enum class State
+    {
+        IDLE,     // 칠 단어를 고르는 중
+        REACTING, // 단어를 보고 반응하는 중
+        TYPING    // 입력 중
+    };
+
+    Profile profile;
+    std::mt19937 rng;
+
+    State state;
+    int targetSlot;       // 입력할 칸 번호
+    std::string target;   // 입력할 단어 ("random" 포함)
+    bool noticingTypo;    // 지금 오타를 고치는 중인지
+    bool ignoringTypo;    // 알아채지 못한 오타를 남긴 채 계속 치는 중인지
+    int64_t nextKeyMillis;
+    int keysSent;
+
+    double uniform() { return std::uniform_real_distribution<double>(0.0, 1.0)(rng); }
+
+    // 다음 키까지의 간격 (WPM 기준 +-30% 흔들림)
+    int64_t keyInterval()
+    {
+        double base = 60000.0 / (profile.wordsPerMinute * 5.0);
+        return static_cast<int64_t>(base * (0.7 + 0.6 * uniform()));
+    }
+
+    static bool equalsIgnoreCase(const std::string &a, const std::string &b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            if (tolower(static_cast<unsigned char>(a[i])) != tolower(static_cast<unsigned char>(b[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool isPrefixIgnoreCase(const std::string &prefix, const std::string &word)
+    {
+        return prefix.size() <= word.size() && equalsIgnoreCase(prefix, word.substr(0, prefix.size()));
+    }
+
+    // 칠 단어 고르기: 아이템 박스 > 가장 아래에 있는 아직 못 맞춘 단어
+    bool chooseTarget(GameSession &session)
+    {
+        SentenceManager *sentenceManager = session.getSentenceManager();
+        InputHandler *input = sentenceManager->getInputHandler();
+        const auto &targetWords = sentenceManager->getTargetWords();
+
+        if (session.getGameManager()->isWaitingForCompletion() || session.isShowingCompletedSnowman())
+        {
+            return false;
+        }
+
+        if (profile.useItems)
+        {
+            for (const auto &box : sentenceManager->getItemBoxes())
+            {
+                if (!box.getIsActive())
+                {
+                    continue;
+                }
+                for (int slot = 0; slot < static_cast<int>(targetWords.size()); slot++)
+                {
+                    if (input->getInputAt(slot).empty())
+                    {
+                        targetSlot = slot;
+                        target = "random";
+                        return true;
+                    }
+                }
+                break;
+            }
+        }
+
+        int bestSlot = -1;
+        int bestY = -1;
+        for (const auto &block : sentenceManager->getWordBlocks())
+        {
+            int slot = block.getOrderIndex();
+            if (!block.active || slot < 0 || slot >= static_cast<int>(targetWords.size()))
+            {
+                continue;
+            }
+            if (input->isWordCorrect(slot, targetWords[slot]))
+            {
+                continue;
+            }
+            if (block.getY() > bestY)
+            {
+                bestY = block.getY();
+                bestSlot = slot;
+            }
+        }
+
+        if (bestSlot < 0)
+        {
+            return false;
+        }
+        targetSlot = bestSlot;
+        target = targetWords[bestSlot];
+        return true;
+    }
+
+    // 오타: 근처 알파벳 하나
+    char typoFor(char intended)
+    {
+        char c = static_cast<char>(tolower(static_cast<unsigned char>(intended)));
+        if (c < 'a' || c > 'z')
+        {
+            return 'x';
+        }
+        int shift = (uniform() < 0.5) ? -1 : 1;
+        int typed = (c - 'a' + shift + 26) % 26;
+        return static_cast<char>('a' + typed);
+    }
+
+    void send(GameSession &session, int key)
+    {
+        session.handleKey(key);
+        keysSent++;
+    }
+
+    // 입력 중 한 타 진행
+    void typeStep(GameSession &session)
+    {
+        InputHandler *input = session.getSentenceManager()->getInputHandler();
+
+        // 문장이 완성되어 다음 라운드를 기다리는 중이면 하던 입력은 버림
+        if (session.getGameManager()->isWaitingForCompletion())
+        {
+            state = State::IDLE;
+            return;
+        }
+
+        // 1. 입력칸 이동
+        int current = input->getCurrentInputIndex();
+        if (current < targetSlot)
+        {
+            send(session, '\t');
+            return;
+        }
+        if (current > targetSlot)
+        {
+            send(session, KEY_UP);
+            return;
+        }
+
+        const std::string &typed = input->getUserInputs()[targetSlot];
+
+        // 2. 오타 처리
+        if (!isPrefixIgnoreCase(typed, target) && !ignoringTypo)
+        {
+            if (noticingTypo)
+            {
+                send(session, KEY_BACKSPACE);
+                return;
+            }
+            // 처음 보는 오타: 고칠지 말지 결정
+            if (uniform() < profile.correctionRate)
+            {
+                noticingTypo = true;
+                send(session, KEY_BACKSPACE);
+                return;
+            }
+            ignoringTypo = true;
+        }
+        noticingTypo = false;
+
+        // 3. 단어 끝까지 쳤으면 Enter
+        if (typed.size() >= target.size())
+        {
+            send(session, '\n');
+            state = State::IDLE;
+            return;
+        }
+
+        // 4. 다음 글자 (가끔 오타)
+        char intended = target[typed.size()];
+        if (uniform() < profile.typoRate)
+        {
+            send(session, typoFor(intended));
+        }
+        else
+        {
+            send(session, intended);
+        }
+    }
+
+public:
+    TypistBot(const Profile &botProfile, uint32_t seed)
+        : profile(botProfile), rng(seed), state(State::IDLE), targetSlot(0),
+          noticingTypo(false), ignoringTypo(false), nextKeyMillis(0), keysSent(0) {}
+
+    // 현재 시각까지 해야 할 입력을 모두 처리
+    void update(GameSession &session, int64_t nowMillis)
+    {
+        while (nextKeyMillis <= nowMillis)
+        {
+            if (state == State::IDLE)
+            {
+                if (!chooseTarget(session))
+                {
+                    nextKeyMillis = nowMillis + 50; // 볼 단어가 없으면 잠시 뒤 다시 확인
+                    return;
+                }
+                noticingTypo = false;
+                ignoringTypo = false;
+                state = State::REACTING;
+                nextKeyMillis += profile.reactionMillis;
+                if (nextKeyMillis < nowMillis)
+                {
+                    nextKeyMillis = nowMillis + profile.reactionMillis;
+                }
+                continue;
+            }
+
+            state = State::TYPING;
+            typeStep(session);
+            nextKeyMillis += keyInterval();
+        }
+    }
+
+    int getKeysSent() const { return keysSent; }
+};
+
+#endif // TYPISTBOT_H
@@ -0,0 +1,88 @@
+#ifndef UNIXLISTENER_H
+#define UNIXLISTENER_H
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// UnixListener: 로컬 Unix 도메인 소켓 하나와 그 소켓을 맡는 스레드 하나
+// MetricsExporter(Prometheus 내보내기)와 SpectatorFeed(관전 방송)가 같이 씀
+// - start(): 이전 실행이 남긴 소켓 파일을 지우고 bind/listen 한 뒤 serve 를 새 스레드에서 실행
+// - serve 는 isStopping() 이 될 때까지 돌되, poll 은 POLL_MILLIS 씩 끊어서 기다려야 stop() 이 오래 걸리지 않음
+// - stop(): 스레드가 끝나길 기다린 뒤 소켓을 닫고 파일을 지움
+class UnixListener
+{
+public:
+    static const int POLL_MILLIS = 200;
+
+private:
+    std::string socketPath;
+    int listenFd;
+    std::atomic<bool> stopping;
+    std::unique_ptr<std::thread> worker;
+
+    UnixListener(const UnixListener &) = delete;
+    UnixListener &operator=(const UnixListener &) = delete;
+
+public:
+    UnixListener() : listenFd(-1), stopping(false) {}
+    ~UnixListener() { stop(); }
+
+    // type: SOCK_STREAM, SOCK_SEQPACKET 등 (SOCK_CLOEXEC, SOCK_NONBLOCK 을 함께 줄 수 있음)
+    // path 가 비어 있거나 nullptr 이거나 너무 길면 false
+    bool start(const char *path, int type, int backlog, std::function<void()> serve)
+    {
+        if (!path || !*path || listenFd >= 0)
+            return false;
+
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (strlen(path) >= sizeof(address.sun_path))
+            return false;
+        strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+        int fd = socket(AF_UNIX, type, 0);
+        if (fd < 0)
+            return false;
+        unlink(path); // 이전 실행이 남긴 소켓 파일
+        if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, backlog) != 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        socketPath = path;
+        listenFd = fd;
+        stopping = false;
+        worker.reset(new std::thread(std::move(serve)));
+        return true;
+    }
+
+    void stop()
+    {
+        if (listenFd < 0)
+            return;
+        stopping = true;
+        if (worker)
+        {
+            worker->join();
+            worker.reset();
+        }
+        close(listenFd);
+        listenFd = -1;
+        unlink(socketPath.c_str());
+    }
+
+    bool isRunning() const { return listenFd >= 0; }
+    bool isStopping() const { return stopping.load(); }
+    int getFd() const { return listenFd; }
+};
+
+#endif // UNIXLISTENER_H
@@ -3,14 +3,17 @@
 
 #include "FallingObject.h"
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <cctype>
+#include "StringUtil.h"
+#include "GameRandom.h"
 
 // WordBlock: 단어 블록
 class WordBlock : public FallingObject
 {
 private:
-    std::string text; // 표시될 단어
+    std::string_view text; // 표시될 단어 (라운드 아레나의 문장을 가리킴, 라운드 동안 유효)
     int orderIndex;   // 문장 내 순서 (0~7)
     bool isInInput;   // 입력창에 입력되었는지
 
@@ -24,11 +27,11 @@ public:
         initialY = y;
     }
 
-    WordBlock(const std::string &word, int order, int areaWidth, int areaHeight, double speed = 1.0)
+    WordBlock(std::string_view word, int order, int areaWidth, int areaHeight, GameRandom &random, double speed = 1.0)
         : FallingObject(areaWidth, areaHeight, speed), text(word), orderIndex(order), isInInput(false)
     {
         // 화면 상단에서 랜덤한 x 위치에 생성 (단어 길이 고려)
-        x = rand() % (gameAreaWidth - static_cast<int>(text.length()) - 2) + 1;
+        x = randomBelow(random, gameAreaWidth - static_cast<int>(text.length()) - 2) + 1;
         y = 3; // 게임 영역 상단
         initialX = x;
         initialY = y;
@@ -87,24 +90,18 @@ public:
     }
 
     // Getter 메서드들
-    const std::string &getText() const { return text; }
+    std::string_view getText() const { return text; }
     int getOrderIndex() const { return orderIndex; }
     bool getIsInInput() const { return isInInput; }
 
     // 매칭 체크 (대소문자 구분 없음)
-    bool matchesWord(const std::string &input) const
+    bool matchesWord(std::string_view input) const
     {
-        std::string inputLower = input;
-        std::string textLower = text;
-
-        std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
-        std::transform(textLower.begin(), textLower.end(), textLower.begin(), ::tolower);
-
-        return inputLower == textLower;
+        return equalsIgnoreCase(input, text);
     }
 
     // 호환성을 위한 public 멤버들
-    std::string word; // text와 동기화
+    std::string_view word; // text와 동기화
     bool active;      // isActive와 동기화
 
     // 위치 접근 메서드들
@@ -119,7 +116,7 @@ public:
     }
 
     // text 설정 함수 추가
-    void setText(const std::string &w)
+    void setText(std::string_view w)
     {
         text = w;
         word = w;
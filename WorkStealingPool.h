@@ -0,0 +1,172 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// WorkStealingPool: 작업 훔치기 스레드 풀
+// - 워커마다 자기 작업 덱을 가지고, 자기 덱은 뒤에서(LIFO) 꺼냄
+// - 자기 덱이 비면 다른 워커 덱의 앞에서(FIFO) 훔쳐 옴
+// - 덱마다 잠금이 따로라서 워커끼리 거의 부딪히지 않음 (작업은 굵게 나눠서 넣을 것)
+class WorkStealingPool
+{
+private:
+    struct Worker
+    {
+        std::mutex lock;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> nextQueue;
+    std::atomic<int> pending; // 아직 끝나지 않은 작업 수
+    std::atomic<bool> stopping;
+
+    std::mutex idleLock;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+
+    // 지금 스레드가 워커로 일하는 풀과 그 번호 (다른 풀의 워커가 submit 하면 밖에서 부른 것으로 침)
+    static inline thread_local WorkStealingPool *currentPool = nullptr;
+    static inline thread_local int currentWorker = -1;
+
+    bool popLocal(int index, std::function<void()> &task)
+    {
+        Worker &worker = *workers[static_cast<size_t>(index)];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        if (worker.tasks.empty())
+        {
+            return false;
+        }
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(int thief, std::function<void()> &task)
+    {
+        size_t count = workers.size();
+        for (size_t offset = 1; offset < count; offset++)
+        {
+            Worker &victim = *workers[(static_cast<size_t>(thief) + offset) % count];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(int index)
+    {
+        currentPool = this;
+        currentWorker = index;
+        std::function<void()> task;
+        while (true)
+        {
+            if (popLocal(index, task) || steal(index, task))
+            {
+                task();
+                task = nullptr;
+                if (--pending == 0)
+                {
+                    std::lock_guard<std::mutex> guard(idleLock);
+                    allDone.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> guard(idleLock);
+            if (stopping)
+            {
+                return;
+            }
+            if (pending.load() == 0 || !hasQueuedWork())
+            {
+                workAvailable.wait(guard);
+            }
+        }
+    }
+
+    bool hasQueuedWork()
+    {
+        for (auto &worker : workers)
+        {
+            std::lock_guard<std::mutex> guard(worker->lock);
+            if (!worker->tasks.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+public:
+    explicit WorkStealingPool(int threadCount = 0) : nextQueue(0), pending(0), stopping(false)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        }
+        for (int i = 0; i < threadCount; i++)
+        {
+            workers.emplace_back(new Worker());
+        }
+        for (int i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+        }
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(idleLock);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // 작업 추가: 워커 안에서 부르면 자기 덱, 밖에서 부르면 돌아가며 분배
+    void submit(std::function<void()> task)
+    {
+        pending++;
+        size_t index = currentPool == this ? static_cast<size_t>(currentWorker)
+                                           : nextQueue++ % workers.size();
+        {
+            std::lock_guard<std::mutex> guard(workers[index]->lock);
+            workers[index]->tasks.push_back(std::move(task));
+        }
+        std::lock_guard<std::mutex> guard(idleLock);
+        workAvailable.notify_one();
+    }
+
+    // 지금까지 넣은 작업이 모두 끝날 때까지 대기
+    void wait()
+    {
+        std::unique_lock<std::mutex> guard(idleLock);
+        allDone.wait(guard, [this]()
+                     { return pending.load() == 0; });
+    }
+
+    int getThreadCount() const { return static_cast<int>(threads.size()); }
+};
+
+#endif // WORKSTEALINGPOOL_H
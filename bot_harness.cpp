@@ -0,0 +1,166 @@
+// bot_harness: 가상 타자 봇으로 헤드리스 게임을 대량으로 돌리는 부하 테스트
+//
+// 사용법:
+//   bot_harness [--games N] [--threads N] [--level L] [--wpm W] [--typo P]
+//               [--correction P] [--reaction MS] [--no-items] [--tick MS] [--seed S]
+//
+// 각 스레드는 가상 시계(GameClock)로 게임을 진행하므로 실제로 기다리지 않는다.
+// 결과: 초당 게임 수, 점수/눈사람/타자 지표(WPM, 정확도, 단어 지연 중앙값) 분포, tick 한 번의 비용(ns) 통계
+// SNOWMAN_METRICS_SOCKET 이 있으면 도는 동안 메트릭을 그 Unix 소켓으로 내보낸다.
+// SNOWMAN_TRACE_FILE 이 있으면 끝난 뒤 스레드별 tick 구간을 trace-event JSON 으로 남긴다 (FrameTrace.h).
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o bot_harness bot_harness.cpp SentenceManager.cpp Dictionary.cpp SnowDict.cpp Metrics.cpp -lncurses
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+#include "BotGame.h"
+#include "TypistBot.h"
+#include "Histogram.h"
+#include "Metrics.h"
+#include "FrameTrace.h"
+
+struct HarnessOptions
+{
+    int games = 1000;
+    int threads = 0;
+    int level = 1;
+    int tickMillis = 50; // 실제 게임 루프의 getch timeout 과 같은 간격
+    uint32_t seed = 12345;
+    TypistBot::Profile profile;
+};
+
+// 스레드별 결과
+struct WorkerStats
+{
+    Histogram tickNanos;
+    Histogram scores;
+    Histogram snowmen;
+    Histogram netWpm;
+    Histogram accuracy;
+    Histogram wordLatency;
+    uint64_t games = 0;
+    uint64_t ticks = 0;
+    uint64_t keys = 0;
+};
+
+static void runGames(const HarnessOptions &options, std::atomic<int> &nextGame, WorkerStats &stats)
+{
+    GameTuning tuning = GameTuning::forLevel(options.level);
+    for (int game = nextGame++; game < options.games; game = nextGame++)
+    {
+        BotGameResult result = runBotGame(options.level, tuning, options.profile,
+                                          options.seed + static_cast<uint32_t>(game),
+                                          options.tickMillis, &stats.tickNanos);
+        stats.scores.record(static_cast<uint64_t>(result.score));
+        stats.snowmen.record(static_cast<uint64_t>(result.snowmen));
+        stats.netWpm.record(static_cast<uint64_t>(result.netWpm));
+        stats.accuracy.record(static_cast<uint64_t>(result.accuracyPercent));
+        stats.wordLatency.record(static_cast<uint64_t>(result.wordLatencyP50));
+        stats.keys += static_cast<uint64_t>(result.keys);
+        stats.ticks += static_cast<uint64_t>(result.ticks);
+        stats.games++;
+    }
+}
+
+static void printDistribution(const char *name, const Histogram &h)
+{
+    std::cout << "  " << std::left << std::setw(10) << name << std::right
+              << " min " << std::setw(8) << h.getMin()
+              << "  p50 " << std::setw(8) << h.percentile(50)
+              << "  p90 " << std::setw(8) << h.percentile(90)
+              << "  p99 " << std::setw(8) << h.percentile(99)
+              << "  max " << std::setw(8) << h.getMax()
+              << "  mean " << std::fixed << std::setprecision(1) << h.getMean() << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    HarnessOptions options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--games" && hasValue)
+            options.games = atoi(argv[++i]);
+        else if (arg == "--threads" && hasValue)
+            options.threads = atoi(argv[++i]);
+        else if (arg == "--level" && hasValue)
+            options.level = atoi(argv[++i]);
+        else if (arg == "--wpm" && hasValue)
+            options.profile.wordsPerMinute = atof(argv[++i]);
+        else if (arg == "--typo" && hasValue)
+            options.profile.typoRate = atof(argv[++i]);
+        else if (arg == "--correction" && hasValue)
+            options.profile.correctionRate = atof(argv[++i]);
+        else if (arg == "--reaction" && hasValue)
+            options.profile.reactionMillis = atoi(argv[++i]);
+        else if (arg == "--tick" && hasValue)
+            options.tickMillis = std::max(1, atoi(argv[++i]));
+        else if (arg == "--seed" && hasValue)
+            options.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--no-items")
+            options.profile.useItems = false;
+        else
+        {
+            std::cerr << "usage: bot_harness [--games N] [--threads N] [--level L] [--wpm W] [--typo P]"
+                         " [--correction P] [--reaction MS] [--no-items] [--tick MS] [--seed S]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    int threadCount = options.threads > 0 ? options.threads
+                                          : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    MetricsExporter metricsExporter;
+    metricsExporter.start(getenv("SNOWMAN_METRICS_SOCKET"));
+
+    std::vector<WorkerStats> perThread(static_cast<size_t>(threadCount));
+    std::atomic<int> nextGame(0);
+
+    auto started = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(runGames, std::cref(options), std::ref(nextGame), std::ref(perThread[static_cast<size_t>(t)]));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    FrameTrace::get().writeFile();
+
+    WorkerStats total;
+    for (const auto &stats : perThread)
+    {
+        total.tickNanos.merge(stats.tickNanos);
+        total.scores.merge(stats.scores);
+        total.snowmen.merge(stats.snowmen);
+        total.netWpm.merge(stats.netWpm);
+        total.accuracy.merge(stats.accuracy);
+        total.wordLatency.merge(stats.wordLatency);
+        total.games += stats.games;
+        total.ticks += stats.ticks;
+        total.keys += stats.keys;
+    }
+
+    std::cout << "=== Bot Harness ===" << std::endl;
+    std::cout << "  games " << total.games << " on " << threadCount << " threads in "
+              << std::fixed << std::setprecision(2) << seconds << " s ("
+              << std::setprecision(1) << total.games / seconds << " games/s, "
+              << total.ticks / seconds << " ticks/s, " << total.keys / seconds << " keys/s)" << std::endl;
+    printDistribution("score", total.scores);
+    printDistribution("snowmen", total.snowmen);
+    printDistribution("net wpm", total.netWpm);
+    printDistribution("accuracy%", total.accuracy);
+    printDistribution("word ms", total.wordLatency);
+    printDistribution("tick ns", total.tickNanos);
+    return 0;
+}
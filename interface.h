@@ -11,10 +11,25 @@
 #include <string>
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 
 #include "GameManger.h"
 #include "SentenceManager.h"
+#include "GameSession.h"
+#include "LatencyTracer.h"
+#include "Leaderboard.h"
+#include "Metrics.h"
 #include "ItemBox.h"
+#include "RenderTarget.h"
+#include "Probes.h"
+#include "FrameTrace.h"
+#include "SpectatorFeed.h"
+#include "SessionRecorder.h"
+#include "Snowfall.h"
+#include "Sprite.h"
 
 // 기본 화면 인터페이스
 class Screen
@@ -32,313 +47,545 @@ public:
 class PlayScreen : public Screen
 {
 private:
+    static const int MAX_KEYS_PER_FRAME = 256; // 한 프레임에 처리할 키 수 (LatencyTracer 가 기억하는 키 수와 같음)
+
     int currentLevel;
     int gameWidth;
     int gameHeight;
     bool gameRunning;
     int gameAreaWidth;                // 게임 영역 폭 (왼쪽)
     int scoreAreaWidth;               // 점수판 영역 폭 (오른쪽)
-    GameManager *gameManager;         // 게임 상태 관리
-    SentenceManager *sentenceManager; // 단어 및 문장 관리
-
-    // 눈사람 완성 애니메이션 관련 변수 추가
-    bool snowmanCompleted;
-    time_t snowmanCompletedTime;
-    bool showCompletedSnowman;
+    GameSession *session;             // 게임 로직 (화면과 분리)
+    GameManager *gameManager;         // 게임 상태 관리 (session 소유)
+    SentenceManager *sentenceManager; // 단어 및 문장 관리 (session 소유)
+    LatencyTracer latencyTracer;      // 키 입력 -> 화면 표시 지연 측정
+    Leaderboard *leaderboard;         // 최종 점수 기록 (InitialScreen 소유, 없으면 기록 안 함)
+    CursesTarget cursesTarget;        // 터미널에 그릴 때의 대상
+    RenderTarget *target;             // 실제로 그리는 곳 (터미널 또는 FrameBuffer)
+    bool ownsTerminal;                // initscr/endwin 을 이 화면이 하는지
+
+    // 관전 중계 (SNOWMAN_SPECTATE_SOCKET), 세션 기록 (SNOWMAN_RECORD_FILE):
+    // 둘 중 하나라도 켜지면 터미널과 함께 mirrorFrame 에도 그려서 바뀐 칸만 내보냄
+    std::unique_ptr<FrameBuffer> mirrorFrame;
+    std::unique_ptr<TeeTarget> mirrorTarget;
+    SpectatorFeed spectatorFeed;
+    SessionRecorder recorder;
 
     // =========================================================
     // 🎨 [Visual Artist] 화면 그리기 도우미 함수들 (Private)
     // =========================================================
+    // 화면은 영역별 창으로 나누어, 그 영역의 데이터가 바뀐 창만 다시 그리고
+    // 프레임마다 flush() (doupdate) 한 번으로 터미널에 내보낸다.
+    // 테두리/제목/조작 안내는 바뀌지 않으므로 처음(또는 크기 변경 후) 한 번만 그린다.
+
+    // 영역 하나 (창과 마지막으로 그린 상태)
+    struct Panel
+    {
+        std::unique_ptr<RenderTarget> window;
+        uint64_t drawnState = 0;
+        bool drawn = false;
+    };
+
+    Panel fieldPanel;      // 왼쪽 게임 영역 (단어 블록, 아이템 박스)
+    Panel timerPanel;      // 남은 시간 + 아이템 효과 박스
+    Panel infoPanel;       // GAME INFO
+    Panel collectionPanel; // 모은 눈사람
+    Panel snowmanPanel;    // 큰 눈사람
+    Panel inputPanel;      // 입력칸 (칸마다 따로 다시 그림)
+    Panel statusPanel;     // 맨 아래 상태 줄
+    uint64_t slotStates[8];
+    bool chromeDrawn;
+    Snowfall snowfall; // 게임 영역 배경 눈 (fieldPanel 창 좌표)
+
+    // 미리 그려 둔 그림 (buildSprites, 창 안 좌표)
+    static const int MAX_COLLECTION = 8; // 모은 눈사람 판에 보이는 최대 수
+    Sprite snowmanSprites[2];                      // 큰 눈사람: [0] 녹은 모습, [1] 완성
+    Sprite collectionSprites[MAX_COLLECTION + 1]; // 모은 눈사람 판: 모은 수 0..8
+    Sprite timerSprite;                            // 시간/아이템 박스 테두리
+    Sprite infoSprite;                             // GAME INFO 구분선과 제목
+    Sprite completeBannerSprite;                   // "SNOWMAN COMPLETE!"
+    Sprite waitingBannerSprite;                    // "COMPLETE SENTENCE!"
+
+    // 상태 값 섞기 (FNV-1a)
+    static uint64_t mix(uint64_t hash, uint64_t value)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            hash ^= (value >> (i * 8)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static uint64_t mixText(uint64_t hash, const char *text, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            hash ^= static_cast<unsigned char>(text[i]);
+            hash *= 1099511628211ULL;
+        }
+        return mix(hash, length);
+    }
+
+    // 창이 있고 그린 뒤 상태가 바뀌었으면 true (상태를 기록함)
+    static bool needsRepaint(Panel &panel, uint64_t state)
+    {
+        if (!panel.window || (panel.drawn && panel.drawnState == state))
+        {
+            return false;
+        }
+        panel.drawn = true;
+        panel.drawnState = state;
+        return true;
+    }
+
+    void openPanels()
+    {
+        int centerX = gameAreaWidth + (gameWidth - gameAreaWidth) / 2;
+        int rightWidth = gameWidth - 1 - (centerX - 13);
+        fieldPanel.window = target->openWindow(gameHeight - 5, gameAreaWidth - 1, 3, 1);
+        timerPanel.window = target->openWindow(8, 22, 4, centerX - 11);
+        infoPanel.window = target->openWindow(6, rightWidth, 13, centerX - 13);
+        collectionPanel.window = target->openWindow(7, rightWidth, 21, centerX - 13);
+        snowmanPanel.window = target->openWindow(6, gameWidth - 1 - (centerX - 10), 30, centerX - 10);
+        inputPanel.window = target->openWindow(10, gameWidth - 1 - (centerX - 14), 37, centerX - 14);
+        statusPanel.window = target->openWindow(1, gameWidth, gameHeight - 1, 0);
+    }
+
+    // 다음 프레임에서 모든 영역을 다시 그리게 함
+    void invalidatePanels()
+    {
+        chromeDrawn = false;
+        for (Panel *panel : {&fieldPanel, &timerPanel, &infoPanel, &collectionPanel, &snowmanPanel, &inputPanel, &statusPanel})
+        {
+            panel->drawn = false;
+        }
+    }
 
     // 1. 전체 테두리 및 구획 나누기 (안전한 ASCII 문자 버전)
     void drawFrame()
     {
-        attron(COLOR_PAIR(1));
+        target->attrOn(COLOR_PAIR(1));
 
         // 상단 가로선 (+와 -로 그리기)
-        mvprintw(0, 0, "+");
-        for (int i = 1; i < gameAreaWidth; i++) mvprintw(0, i, "-");
-        mvprintw(0, gameAreaWidth, "+");
-        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) mvprintw(0, i, "-");
-        mvprintw(0, gameWidth - 1, "+");
+        target->print(0, 0, "+");
+        for (int i = 1; i < gameAreaWidth; i++) target->print(0, i, "-");
+        target->print(0, gameAreaWidth, "+");
+        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) target->print(0, i, "-");
+        target->print(0, gameWidth - 1, "+");
 
         // 상단 제목 영역
-        mvprintw(1, 0, "|");
-        mvprintw(1, 2, "SNOW MAN GAME - Level %d", currentLevel);
-        mvprintw(1, gameAreaWidth, "|");
-        mvprintw(1, gameAreaWidth + 2, "Let's Build a Snowman!");
-        mvprintw(1, gameWidth - 1, "|");
+        target->print(1, 0, "|");
+        target->print(1, 2, "SNOW MAN GAME - Level %d", currentLevel);
+        target->print(1, gameAreaWidth, "|");
+        target->print(1, gameAreaWidth + 2, "Let's Build a Snowman!");
+        target->print(1, gameWidth - 1, "|");
 
         // 중간 가로선
-        mvprintw(2, 0, "+");
-        for (int i = 1; i < gameAreaWidth; i++) mvprintw(2, i, "-");
-        mvprintw(2, gameAreaWidth, "+");
-        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) mvprintw(2, i, "-");
-        mvprintw(2, gameWidth - 1, "+");
+        target->print(2, 0, "+");
+        for (int i = 1; i < gameAreaWidth; i++) target->print(2, i, "-");
+        target->print(2, gameAreaWidth, "+");
+        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) target->print(2, i, "-");
+        target->print(2, gameWidth - 1, "+");
 
         // 세로선 그리기 (|로 그리기)
         for (int row = 3; row < gameHeight - 2; row++)
         {
-            mvprintw(row, 0, "|");             // 왼쪽 끝
-            mvprintw(row, gameAreaWidth, "|"); // 중간 구분선
-            mvprintw(row, gameWidth - 1, "|"); // 오른쪽 끝
+            target->print(row, 0, "|");             // 왼쪽 끝
+            target->print(row, gameAreaWidth, "|"); // 중간 구분선
+            target->print(row, gameWidth - 1, "|"); // 오른쪽 끝
         }
 
         // 하단 가로선
-        mvprintw(gameHeight - 2, 0, "+");
-        for (int i = 1; i < gameAreaWidth; i++) mvprintw(gameHeight - 2, i, "-");
-        mvprintw(gameHeight - 2, gameAreaWidth, "+");
-        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) mvprintw(gameHeight - 2, i, "-");
-        mvprintw(gameHeight - 2, gameWidth - 1, "+");
-
-        attroff(COLOR_PAIR(1));
+        target->print(gameHeight - 2, 0, "+");
+        for (int i = 1; i < gameAreaWidth; i++) target->print(gameHeight - 2, i, "-");
+        target->print(gameHeight - 2, gameAreaWidth, "+");
+        for (int i = gameAreaWidth + 1; i < gameWidth - 1; i++) target->print(gameHeight - 2, i, "-");
+        target->print(gameHeight - 2, gameWidth - 1, "+");
+
+        target->attrOff(COLOR_PAIR(1));
+
+        // 컨트롤 가이드 (하단 가로선 위)
+        int centerX = gameAreaWidth + (gameWidth - gameAreaWidth) / 2;
+        const char *guide = "TAB: Next | ESC: Menu | Type 'random' for item";
+        target->print(gameHeight - 2, centerX - (static_cast<int>(strlen(guide)) / 2), "%s", guide);
     }
 
-    // 2. 큰 눈사람 그리기 (옵션 2: 뚱뚱이 찹쌀떡 스타일)
-    void drawBigSnowman(int y, int x, bool isComplete)
+    // 바뀌지 않는 그림을 한 번만 chtype 배열로 그려 둠 (창 안 좌표, 속성까지)
+    void buildSprites()
     {
-        if (isComplete)
+        // 큰 눈사람 (옵션 2: 뚱뚱이 찹쌀떡 스타일)
+        // 동그랗게 녹은 모습
+        snowmanSprites[0] = Sprite(6, 23);
+        snowmanSprites[0]
+            .text(3, 0, "         . . .        ", COLOR_PAIR(5))
+            .text(4, 0, "      (  x _ x  )    ", COLOR_PAIR(5))
+            .text(5, 0, "     (___________)   ", COLOR_PAIR(5));
+        // 완성: 얼굴 (납작하고 귀여움, 찡긋) + 몸통 (푸짐함, 나뭇가지 팔)
+        snowmanSprites[1] = Sprite(6, 23);
+        snowmanSprites[1]
+            .text(0, 0, "       .-------.       ", COLOR_PAIR(5) | A_BOLD)
+            .text(1, 0, "      (  ^ _ ^  )      ", COLOR_PAIR(5) | A_BOLD)
+            .text(2, 0, "   .--'         '--.   ", COLOR_PAIR(5) | A_BOLD)
+            .text(3, 0, " _(        :        )_ ", COLOR_PAIR(5) | A_BOLD)
+            .text(4, 0, "(_____________________)", COLOR_PAIR(5) | A_BOLD);
+
+        // 작은 눈사람 점수판 (2단 미니 스타일, 노란색): 모은 수마다 한 장
+        for (int count = 0; count <= MAX_COLLECTION; count++)
         {
-            attron(COLOR_PAIR(5) | A_BOLD);
-            // 얼굴 (납작하고 귀여움)
-            mvprintw(y + 3, x, "       .-------.       ");
-            mvprintw(y + 4, x, "      (  ^ _ ^  )      "); // 찡긋
-
-            // 몸통 (푸짐함)
-            mvprintw(y + 5, x, "   .--'         '--.   ");
-            mvprintw(y + 6, x, " _(        :        )_ "); // 나뭇가지 팔 추가!
-            mvprintw(y + 7, x, "(_____________________)");
-            attroff(COLOR_PAIR(5) | A_BOLD);
+            Sprite &sprite = collectionSprites[count];
+            sprite = Sprite(7, 28);
+            sprite.text(0, 6, "[ COLLECTION ]", COLOR_PAIR(2));
+            for (int i = 0; i < MAX_COLLECTION; i++)
+            {
+                // 2줄 간격(padding)을 활용해 머리와 몸통을 따로 그림
+                int drawY = 2 + (i / 4) * 3; // 간격을 3칸으로 살짝 늘림
+                int drawX = (i % 4) * 7;
+                if (i < count)
+                {
+                    sprite.text(drawY, drawX, "  o  ", COLOR_PAIR(2) | A_BOLD);     // 머리
+                    sprite.text(drawY + 1, drawX, " (:) ", COLOR_PAIR(2) | A_BOLD); // 몸통
+                }
+                else
+                {
+                    // 빈 자리 표시
+                    sprite.text(drawY, drawX, "  .  ", COLOR_PAIR(2));
+                    sprite.text(drawY + 1, drawX, "  .  ", COLOR_PAIR(2));
+                }
+            }
         }
-        else
-    {
-        // 동그랗게 녹은 모습
-        attron(COLOR_PAIR(5));
-        mvprintw(y + 6, x, "         . . .        ");
-        mvprintw(y + 7, x, "      (  x _ x  )    ");
-        mvprintw(y + 8, x, "     (___________)   ");
-        attroff(COLOR_PAIR(5));
+
+        // 시간 박스 + 아이템 박스 테두리 (안의 글자는 그릴 때)
+        timerSprite = Sprite(8, 22);
+        timerSprite
+            .text(0, 0, "+--------------------+", COLOR_PAIR(5))
+            .text(1, 0, "|   TIME REMAINING   |", COLOR_PAIR(5))
+            .text(2, 0, "|                    |", COLOR_PAIR(5) | A_BOLD)
+            .text(3, 0, "+--------------------+", COLOR_PAIR(5))
+            .text(5, 0, "+--------------------+", COLOR_PAIR(4) | A_BOLD)
+            .text(6, 0, "|                    |", COLOR_PAIR(4) | A_BOLD)
+            .text(7, 0, "+--------------------+", COLOR_PAIR(4) | A_BOLD);
+
+        // GAME INFO
+        const char *divider = "==========================";
+        infoSprite = Sprite(6, 26);
+        infoSprite.text(0, 0, divider).text(1, 8, "GAME INFO").text(2, 0, divider).text(5, 0, divider);
+        completeBannerSprite = Sprite(1, 25);
+        completeBannerSprite.text(0, 1, "   SNOWMAN COMPLETE!    ", COLOR_PAIR(2) | A_BOLD);
+        waitingBannerSprite = Sprite(1, 25);
+        waitingBannerSprite.text(0, 1, "   COMPLETE SENTENCE!   ", COLOR_PAIR(2) | A_BOLD);
     }
+
+    // 2. 큰 눈사람 그리기 (창 안 좌표)
+    void drawBigSnowman(RenderTarget &window, bool isComplete)
+    {
+        window.clear();
+        snowmanSprites[isComplete ? 1 : 0].draw(window);
     }
-        
-    // 3. 작은 눈사람 점수판 (2단 미니 스타일)
-    void drawLifeSnowmen(int y, int x, int count)
+
+    // 3. 작은 눈사람 점수판 (창 안 좌표)
+    void drawLifeSnowmen(RenderTarget &window, int count)
     {
-        attron(COLOR_PAIR(2)); // YELLOW
-        mvprintw(y, x+6, "[ COLLECTION ]");
+        window.clear();
+        collectionSprites[std::min(std::max(count, 0), static_cast<int>(MAX_COLLECTION))].draw(window);
+    }
 
-        int maxSnowmen = 8;
-        int displayCount = std::min(count, maxSnowmen);
+    // 4. 시간 + 아이템 효과 박스 (창 안 좌표, 창 가운데가 11)
+    void drawTimerBox(RenderTarget &window, const char *timeStr, const char *itemMsg)
+    {
+        window.clear();
+        timerSprite.draw(window);
 
-        for (int i = 0; i < maxSnowmen; i++)
-        {
-            // 2줄 간격(padding)을 활용해 머리와 몸통을 따로 그림
-            int drawY = y + 2 + (i / 4) * 3; // 간격을 3칸으로 살짝 늘림
-            int drawX = x + (i % 4) * 7;     
+        window.attrOn(COLOR_PAIR(5) | A_BOLD);
+        window.print(2, 11 - (static_cast<int>(strlen(timeStr)) / 2), "%s", timeStr);
+        window.attrOff(COLOR_PAIR(5) | A_BOLD);
 
-            if (i < displayCount)
-            {
-                attron(A_BOLD);
-                mvprintw(drawY,     drawX, "  o  "); // 머리
-                mvprintw(drawY + 1, drawX, " (:) "); // 몸통
-                attroff(A_BOLD);
-            }
-            else
-            {
-                // 빈 자리 표시
-                mvprintw(drawY,     drawX, "  .  ");
-                mvprintw(drawY + 1, drawX, "  .  ");
-            }
-        }
-        attroff(COLOR_PAIR(2));
+        window.attrOn(COLOR_PAIR(4) | A_BOLD);
+        window.print(6, 11 - (static_cast<int>(strlen(itemMsg)) / 2), "%s", itemMsg);
+        window.attrOff(COLOR_PAIR(4) | A_BOLD);
     }
-    
-   // 4. 텍스트 정보 출력 (큰 눈사람 위치 미세 조정 버전)
-    void drawInfoPanel()
+
+    // 5. GAME INFO (창 안 좌표)
+    void drawGameInfo(RenderTarget &window, bool showCompletedSnowman)
     {
-        attron(COLOR_PAIR(5));
-        
-        // 오른쪽 패널의 중심점 계산
-        int rightPanelStart = gameAreaWidth;
-        int rightPanelWidth = gameWidth - gameAreaWidth;
-        int centerX = rightPanelStart + (rightPanelWidth / 2); 
-
-        // -----------------------------------------------------------
-        // 1. 상단: TIME & ITEM 
-        // -----------------------------------------------------------
-        
-        // 시간 박스
-        mvprintw(4, centerX - 11, "+--------------------+");
-        mvprintw(5, centerX - 11, "|   TIME REMAINING   |");
-        
-        attron(A_BOLD);
-        std::string timeStr = gameManager->getFormattedTime();
-        int timeX = centerX - (timeStr.length() / 2); 
-        mvprintw(6, centerX - 11, "|                    |"); 
-        mvprintw(6, timeX, "%s", timeStr.c_str());
-        attroff(A_BOLD);
-        
-        mvprintw(7, centerX - 11, "+--------------------+");
-
-        // 아이템 박스
-        attron(COLOR_PAIR(4) | A_BOLD);
-        mvprintw(9, centerX - 11, "+--------------------+");
-        
-        std::string itemMsg;
-        if (gameManager->shouldDisplayItemEffect()) {
-            itemMsg = gameManager->getLastItemEffectMessage();
-        } else {
-            itemMsg = "ITEM EFFECT READY";
-        }
-        
-        int msgX = centerX - (itemMsg.length() / 2);
-        mvprintw(10, centerX - 11, "|                    |");
-        mvprintw(10, msgX, "%s", itemMsg.c_str());
-        
-        mvprintw(11, centerX - 11, "+--------------------+");
-        attroff(COLOR_PAIR(4) | A_BOLD);
-
-
-        // -----------------------------------------------------------
-        // 2. 중단: GAME INFO
-        // -----------------------------------------------------------
-        const char* divider = "==========================";
-        int divX = centerX - 13; 
-
-        mvprintw(13, divX, "%s", divider);
-        mvprintw(14, centerX - 5, "GAME INFO"); 
-        mvprintw(15, divX, "%s", divider);
-
-        mvprintw(16, divX + 2, "LEVEL: %-2d    SCORE: %-4d", currentLevel, gameManager->getTotalScore());
+        window.clear();
+        infoSprite.draw(window);
+
+        window.print(3, 2, "LEVEL: %-2d    SCORE: %-4d", currentLevel, gameManager->getTotalScore());
 
         if (showCompletedSnowman)
         {
-            attron(COLOR_PAIR(2) | A_BOLD);
-            std::string msg = "   SNOWMAN COMPLETE!    ";
-            mvprintw(17, divX + 1, "%s", msg.c_str());
-            attroff(COLOR_PAIR(2) | A_BOLD);
+            completeBannerSprite.draw(window, 4, 0);
         }
         else if (gameManager->isWaitingForCompletion())
         {
-            attron(COLOR_PAIR(2) | A_BOLD);
-            std::string msg = "   COMPLETE SENTENCE!   ";
-            mvprintw(17, divX + 1, "%s", msg.c_str());
-            attroff(COLOR_PAIR(2) | A_BOLD);
+            waitingBannerSprite.draw(window, 4, 0);
         }
         else
         {
-            mvprintw(17, divX + 2, "WORDS: %d/8    MATCH: %d/8", 
-                     gameManager->getCurrentWordIndex(), sentenceManager->getCorrectMatches());
+            window.print(4, 2, "WORDS: %d/8    MATCH: %d/8",
+                         gameManager->getCurrentWordIndex(), sentenceManager->getCorrectMatches());
         }
+    }
 
-        mvprintw(18, divX, "%s", divider);
-        attroff(COLOR_PAIR(5));
-
-
-        // -----------------------------------------------------------
-        // 3. 하단: Collection & Big Snowman (위치 미세 조정)
-        // -----------------------------------------------------------
-        
-        // [Collection 중앙 정렬]
-        int collectionX = centerX - 13;
-        int collectionY = 21;
-        drawLifeSnowmen(collectionY, collectionX, gameManager->getCollectedSnowmen());
+    // 6. 입력칸 한 줄 (창 안 좌표, 제목 아래 2줄부터), 지금 칸이면 가장 가까운 단어 힌트도
+    // (힌트는 단어만: 그 단어가 몇 번째 칸인지 보여 주면 문장 순서를 맞히는 퍼즐의 답이 됨)
+    void drawInputSlot(RenderTarget &window, int i, const std::string &text, bool highlighted, std::string_view hint)
+    {
+        window.clearToEndOfLine(2 + i, 0);
+        if (highlighted)
+        {
+            window.attrOn(COLOR_PAIR(2) | A_BOLD);
+            window.print(2 + i, 4, "[%d] > %s_", i + 1, text.c_str());
+            window.attrOff(COLOR_PAIR(2) | A_BOLD);
+            // 힌트는 창 오른쪽 끝에서 자름 (넘치면 다음 칸 줄로 이어져 그 줄이 다시 그려질 때까지 남음)
+            int hintX = 12 + static_cast<int>(text.size());
+            int hintRoom = window.getWidth() - hintX - 2;
+            if (!hint.empty() && hintRoom > 0)
+            {
+                window.attrOn(COLOR_PAIR(5));
+                window.print(2 + i, hintX, "~ %.*s", std::min(static_cast<int>(hint.size()), hintRoom), hint.data());
+                window.attrOff(COLOR_PAIR(5));
+            }
+        }
+        else
+        {
+            window.attrOn(COLOR_PAIR(3));
+            window.print(2 + i, 4, "[%d]   %s", i + 1, text.c_str());
+            window.attrOff(COLOR_PAIR(3));
+        }
+    }
 
-        // [Big Snowman 왼쪽으로 조금 더 이동]
-        // 기존: centerX - 8  -> 수정: centerX - 10 (2칸 더 왼쪽으로)
-        int snowmanX = centerX - 10;
-        int snowmanY = 27; // 높이 유지
-        drawBigSnowman(snowmanY, snowmanX, showCompletedSnowman);
+    // 7. 배경 효과 + 게임 영역 (창 안 좌표 = 화면 좌표 - (3, 1))
+    // 눈을 먼저 다 그리고 그 위에 그리는 칸은 snowfall 에 덮인 칸으로 알려 둠 (다음 프레임부터 눈은 바뀐 칸만)
+    void drawField(RenderTarget &window)
+    {
+        window.clear();
+        snowfall.clearCover();
+        snowfall.drawAll(window);
 
+        // 아이템 효과 알림 (3초간 강조 표시)
+        if (gameManager->shouldDisplayItemEffect())
+        {
+            const char *message = gameManager->getLastItemEffectMessage();
+            window.attrOn(COLOR_PAIR(4) | A_BOLD);
+            window.print(1, 1, "*** %s ***", message);
+            window.attrOff(COLOR_PAIR(4) | A_BOLD);
+            snowfall.cover(1, 1, static_cast<int>(strlen(message)) + 8);
+        }
 
-        // -----------------------------------------------------------
-        // 4. 최하단: 입력창
-        // -----------------------------------------------------------
-        int inputStartY = 37; 
-        
-        attron(COLOR_PAIR(3));
-        std::string inputTitle = "======== WORD INPUT ========";
-        mvprintw(inputStartY, centerX - (inputTitle.length() / 2), "%s", inputTitle.c_str());
+        // 목표물
+        window.attrOn(COLOR_PAIR(4));
+        for (int col = 12; col < gameAreaWidth; col += 12)
+        {
+            window.print(gameHeight - 7, col - 1, "X");
+            snowfall.cover(gameHeight - 7, col - 1, 1);
+        }
+        window.attrOff(COLOR_PAIR(4));
 
-        const auto &userInputs = sentenceManager->getInputHandler()->getUserInputs();
-        int currentIdx = sentenceManager->getInputHandler()->getCurrentInputIndex();
+        // 단어 블록 렌더링 (배경 위에 덮어씌우기)
+        window.attrOn(COLOR_PAIR(6) | A_BOLD);
+        for (const auto &block : sentenceManager->getWordBlocks())
+        {
+            // active 체크와 화면 범위 체크
+            if (block.active && block.getY() >= 3 && block.getY() < gameHeight - 2)
+            {
+                int blockX = block.getX();
+                int blockY = block.getY();
 
-        int inputLineX = centerX - 10;
+                // 단어가 화면 범위 내에 있는지 확인
+                if (blockX >= 1 && blockX + (int)block.word.length() < gameAreaWidth - 1)
+                {
+                    window.print(blockY - 3, blockX - 1, "%.*s", static_cast<int>(block.word.size()), block.word.data());
+                    snowfall.cover(blockY - 3, blockX - 1, static_cast<int>(block.word.size()));
+                }
+            }
+        }
+        window.attrOff(COLOR_PAIR(6) | A_BOLD);
 
-        for (int i = 0; i < 8; i++)
+        // 아이템 박스 렌더링
+        window.attrOn(COLOR_PAIR(4) | A_BOLD);
+        for (const auto &box : sentenceManager->getItemBoxes())
         {
-            if (i == currentIdx && !showCompletedSnowman)
+            if (box.getIsActive() && box.getY() >= 3 && box.getY() < gameHeight - 2)
             {
-                attron(COLOR_PAIR(2) | A_BOLD);
-                mvprintw(inputStartY + 2 + i, inputLineX, "[%d] > %s_",
-                         i + 1, userInputs[i].c_str());
-                attroff(COLOR_PAIR(2) | A_BOLD);
+                int boxX = box.getX();
+                int boxY = box.getY();
+
+                if (boxX >= 1 && boxX + 2 < gameAreaWidth - 1)
+                {
+                    window.print(boxY - 3, boxX - 1, "[?]");
+                    snowfall.cover(boxY - 3, boxX - 1, 3);
+                }
             }
-            else
+        }
+        window.attrOff(COLOR_PAIR(4) | A_BOLD);
+    }
+
+    // 게임 영역에 보이는 것들의 상태
+    uint64_t fieldState() const
+    {
+        uint64_t state = 14695981039346656037ULL;
+        for (const auto &block : sentenceManager->getWordBlocks())
+        {
+            state = mix(state, (static_cast<uint64_t>(block.getX()) << 32) | static_cast<uint32_t>(block.getY()));
+            state = mix(state, block.active);
+            state = mixText(state, block.word.data(), block.word.size());
+        }
+        for (const auto &box : sentenceManager->getItemBoxes())
+        {
+            state = mix(state, (static_cast<uint64_t>(box.getX()) << 32) | static_cast<uint32_t>(box.getY()));
+            state = mix(state, box.getIsActive());
+        }
+        if (gameManager->shouldDisplayItemEffect())
+        {
+            const char *message = gameManager->getLastItemEffectMessage();
+            state = mixText(state, message, strlen(message));
+        }
+        return state;
+    }
+
+    // 바뀐 영역만 다시 그려서 올려 둠
+    void drawPanels()
+    {
+        bool showCompletedSnowman = session->isShowingCompletedSnowman();
+        char timeStr[16];
+        gameManager->formatTime(timeStr, sizeof(timeStr));
+
+        int sessionId = session->getId();
+        if (!chromeDrawn)
+        {
+            TraceSpan span("background", sessionId);
+            target->clear();
+            drawFrame();
+            target->stage();
+            chromeDrawn = true;
+        }
+
+        if (needsRepaint(fieldPanel, fieldState()))
+        {
+            TraceSpan span("entities", sessionId);
+            drawField(*fieldPanel.window);
+            fieldPanel.window->stage();
+        }
+        else if (fieldPanel.window && snowfall.isEnabled())
+        {
+            TraceSpan span("snow", sessionId);
+            if (snowfall.drawChanged(*fieldPanel.window) > 0)
             {
-                attron(COLOR_PAIR(3));
-                mvprintw(inputStartY + 2 + i, inputLineX, "[%d]   %s",
-                         i + 1, userInputs[i].c_str());
-                attroff(COLOR_PAIR(3));
+                fieldPanel.window->stage();
             }
         }
 
-        // 컨트롤 가이드
-        int guideY = gameHeight - 2; 
-        std::string guide = "TAB: Next | ESC: Menu | Type 'random' for item";
-        mvprintw(guideY, centerX - (guide.length()/2), "%s", guide.c_str());
-        
-        attroff(COLOR_PAIR(3));
+        const char *itemMsg = gameManager->shouldDisplayItemEffect() ? gameManager->getLastItemEffectMessage()
+                                                                     : "ITEM EFFECT READY";
+        if (needsRepaint(timerPanel, mixText(mix(0, gameManager->getRemainingTime()), itemMsg, strlen(itemMsg))))
+        {
+            TraceSpan span("timer panel", sessionId);
+            drawTimerBox(*timerPanel.window, timeStr, itemMsg);
+            timerPanel.window->stage();
+        }
 
-        // 상태 메시지
-        if (gameManager->isTimeUp())
+        uint64_t info = mix(0, gameManager->getTotalScore());
+        info = mix(info, (showCompletedSnowman ? 1 : 0) | (gameManager->isWaitingForCompletion() ? 2 : 0));
+        info = mix(info, (static_cast<uint64_t>(gameManager->getCurrentWordIndex()) << 32) | sentenceManager->getCorrectMatches());
+        if (needsRepaint(infoPanel, info))
         {
-            attron(COLOR_PAIR(4) | A_BOLD);
-            mvprintw(gameHeight - 1, 2, "TIME UP! Score: %d | Press ESC", gameManager->getTotalScore());
-            attroff(COLOR_PAIR(4) | A_BOLD);
+            TraceSpan span("info panel", sessionId);
+            drawGameInfo(*infoPanel.window, showCompletedSnowman);
+            infoPanel.window->stage();
         }
-        else if (!gameManager->isGameRunning() && gameRunning)
+
+        if (needsRepaint(collectionPanel, gameManager->getCollectedSnowmen()))
         {
-            attron(COLOR_PAIR(2) | A_BOLD);
-            mvprintw(gameHeight - 1, 2, "Complete! Score: %d | Press ESC", gameManager->getTotalScore());
-            attroff(COLOR_PAIR(2) | A_BOLD);
+            TraceSpan span("collection panel", sessionId);
+            drawLifeSnowmen(*collectionPanel.window, gameManager->getCollectedSnowmen());
+            collectionPanel.window->stage();
         }
-        else
+
+        if (needsRepaint(snowmanPanel, showCompletedSnowman))
         {
-            mvprintw(gameHeight - 1, 2, "Running... | %s | Score: %d", 
-                     gameManager->getFormattedTime().c_str(), gameManager->getTotalScore());
+            TraceSpan span("snowman panel", sessionId);
+            drawBigSnowman(*snowmanPanel.window, showCompletedSnowman);
+            snowmanPanel.window->stage();
         }
 
-        refresh();
-    }
+        // 입력칸: 창 전체는 처음 한 번, 그 뒤로는 바뀐 칸만
+        if (inputPanel.window)
+        {
+            TraceSpan span("input panel", sessionId);
+            RenderTarget &window = *inputPanel.window;
+            bool fullRepaint = !inputPanel.drawn;
+            if (fullRepaint)
+            {
+                window.clear();
+                window.attrOn(COLOR_PAIR(3));
+                const char *inputTitle = "======== WORD INPUT ========";
+                window.print(0, 14 - (static_cast<int>(strlen(inputTitle)) / 2), "%s", inputTitle);
+                window.attrOff(COLOR_PAIR(3));
+                inputPanel.drawn = true;
+            }
 
-    // 5. 입력창 그리기 (drawInfoPanel에서 통합해서 사용 안 함 - 중복 방지)
-    void drawInputArea()
-    {
-        // drawInfoPanel에서 처리하므로 비워둠 or 삭제 가능
-    }
+            const auto &userInputs = sentenceManager->getInputHandler()->getUserInputs();
+            int currentIdx = sentenceManager->getInputHandler()->getCurrentInputIndex();
+            int hintSlot = sentenceManager->getHintWord();
+            std::string_view hint = hintSlot >= 0 ? sentenceManager->getTargetWords()[hintSlot] : std::string_view();
+            bool changed = fullRepaint;
+            for (int i = 0; i < 8; i++)
+            {
+                bool highlighted = i == currentIdx && !showCompletedSnowman;
+                uint64_t state = mixText(mix(0, highlighted), userInputs[i].data(), userInputs[i].size());
+                if (highlighted)
+                {
+                    state = mixText(state, hint.data(), hint.size());
+                }
+                if (fullRepaint || slotStates[i] != state)
+                {
+                    slotStates[i] = state;
+                    drawInputSlot(window, i, userInputs[i], highlighted, highlighted ? hint : std::string_view());
+                    changed = true;
+                }
+            }
+            if (changed)
+            {
+                window.stage();
+            }
+        }
 
-    // 6. 배경 효과
-    void drawBackgroundEffect()
-    {
-        attron(COLOR_PAIR(3));
-        // 일단은 장식용 눈송이만 찍어둡니다.
-        // 나중에 sentenceManager->getFallingObjects() 로직이 생기면 교체하세요!
-        mvprintw(5, 10, "*");
-        mvprintw(8, 25, ".");
-        mvprintw(12, 15, "*");
-        mvprintw(15, 40, "*");
-        mvprintw(20, 5, ".");
-        mvprintw(10, 50, "~");
-        mvprintw(22, 55, "*");
-
-        attroff(COLOR_PAIR(3));
+        // 상태 메시지
+        uint64_t status = mix(0, gameManager->getTotalScore());
+        status = mix(status, (gameManager->isTimeUp() ? 1 : 0) | (gameManager->isGameRunning() ? 2 : 0) | (gameRunning ? 4 : 0));
+        status = mix(status, gameManager->getRemainingTime());
+        if (needsRepaint(statusPanel, status))
+        {
+            TraceSpan span("status panel", sessionId);
+            RenderTarget &window = *statusPanel.window;
+            window.clear();
+            if (gameManager->isTimeUp())
+            {
+                window.attrOn(COLOR_PAIR(4) | A_BOLD);
+                window.print(0, 2, "TIME UP! Score: %d | Press ESC", gameManager->getTotalScore());
+                window.attrOff(COLOR_PAIR(4) | A_BOLD);
+            }
+            else if (!gameManager->isGameRunning() && gameRunning)
+            {
+                window.attrOn(COLOR_PAIR(2) | A_BOLD);
+                window.print(0, 2, "Complete! Score: %d | Press ESC", gameManager->getTotalScore());
+                window.attrOff(COLOR_PAIR(2) | A_BOLD);
+            }
+            else
+            {
+                window.print(0, 2, "Running... | %s | Score: %d", timeStr, gameManager->getTotalScore());
+            }
+            window.stage();
+        }
     }
 
 public:
-    PlayScreen(int level) : currentLevel(level), gameWidth(120), gameHeight(50), gameRunning(true),
-                            gameAreaWidth(60), scoreAreaWidth(58),
-                            snowmanCompleted(false), snowmanCompletedTime(0), showCompletedSnowman(false)
+    PlayScreen(int level, Leaderboard *board = nullptr)
+        : currentLevel(level), gameWidth(120), gameHeight(50), gameRunning(true),
+          gameAreaWidth(60), scoreAreaWidth(58), leaderboard(board), target(&cursesTarget), ownsTerminal(true),
+          chromeDrawn(false), snowfall(gameHeight - 5, gameAreaWidth - 1, Snowfall::configuredCount(), level, GameClock::nowMillis())
     {
         setlocale(LC_ALL, "");
         initscr();
@@ -364,22 +611,57 @@ public:
         clear();
         refresh();
 
-        gameManager = new GameManager(currentLevel);
-        sentenceManager = new SentenceManager(currentLevel);
-        gameManager->startGame(sentenceManager);
+        session = new GameSession(currentLevel, gameAreaWidth, gameHeight);
+        gameManager = session->getGameManager();
+        sentenceManager = session->getSentenceManager();
+
+        bool spectating = spectatorFeed.start(getenv("SNOWMAN_SPECTATE_SOCKET"), gameHeight, gameWidth);
+        bool recording = recorder.start(getenv("SNOWMAN_RECORD_FILE"), gameHeight, gameWidth);
+        if (spectating || recording)
+        {
+            mirrorFrame.reset(new FrameBuffer(gameHeight, gameWidth));
+            mirrorTarget.reset(new TeeTarget(cursesTarget, *mirrorFrame));
+            target = mirrorTarget.get();
+        }
+        buildSprites();
+        openPanels();
+    }
+
+    // 터미널 없이 renderTarget 에 그리기만 하는 화면 (렌더링 측정, 골든 프레임 테스트)
+    // UpdateScreen() 으로 한 프레임씩 진행하고, 키 입력은 getSession()->handleKey() 로 직접 넣는다.
+    PlayScreen(int level, RenderTarget &renderTarget)
+        : currentLevel(level), gameWidth(120), gameHeight(50), gameRunning(true),
+          gameAreaWidth(60), scoreAreaWidth(58), leaderboard(nullptr), target(&renderTarget), ownsTerminal(false),
+          chromeDrawn(false), snowfall(gameHeight - 5, gameAreaWidth - 1, Snowfall::configuredCount(), level, GameClock::nowMillis())
+    {
+        session = new GameSession(currentLevel, gameAreaWidth, gameHeight);
+        gameManager = session->getGameManager();
+        sentenceManager = session->getSentenceManager();
+        buildSprites();
+        openPanels();
     }
 
     ~PlayScreen()
     {
-        delete gameManager;
-        delete sentenceManager;
-        endwin();
+        delete session;
+        for (Panel *panel : {&fieldPanel, &timerPanel, &infoPanel, &collectionPanel, &snowmanPanel, &inputPanel, &statusPanel})
+        {
+            panel->window.reset(); // endwin 전에 창 정리
+        }
+        if (ownsTerminal)
+        {
+            endwin();
+        }
     }
 
+    GameSession *getSession() const { return session; }
+    bool isRunning() const { return gameRunning; }
+
     void resizeTerminal(int width, int height)
     {
         resizeterm(height, width);
         clear();
+        invalidatePanels();
     }
 
     // 필수 함수 구현 (누락 방지)
@@ -387,6 +669,7 @@ public:
     {
         resizeterm(gameHeight, gameWidth);
         clear();
+        invalidatePanels();
     }
 
     // ---------------------------------------------------------
@@ -394,142 +677,33 @@ public:
     // ---------------------------------------------------------
     void UpdateScreen() override
     {
-        clear();
+        TraceSpan span("update", session->getId());
 
         // 1. 데이터 업데이트
-        gameManager->updateTime();
-        sentenceManager->spawnItemBoxIfNeeded(gameAreaWidth, gameHeight - 3);
-
-        // 눈사람 완성 체크 및 애니메이션 처리
-        if (sentenceManager->getCorrectMatches() == 8 && !snowmanCompleted)
-        {
-            snowmanCompleted = true;
-            snowmanCompletedTime = time(nullptr);
-            showCompletedSnowman = true;
-            gameManager->notifySnowmanComplete();
-        }
-
-        // 2초 후 입력칸 초기화 및 눈사람 상태 변경
-        if (snowmanCompleted && showCompletedSnowman)
-        {
-            time_t currentTime = time(nullptr);
-            if (difftime(currentTime, snowmanCompletedTime) >= 2.0)
-            {
-                showCompletedSnowman = false;
-                snowmanCompleted = false;
-                // 입력칸 모두 비우기
-                sentenceManager->getInputHandler()->resetInputs();
-
-                gameManager->prepareNextRound(sentenceManager);
-            }
-        }
-
-        // 단어 블록 이동 (1초 간격)
-        if (gameManager->shouldUpdateWordBlocks())
-        {
-            sentenceManager->advanceWordBlocks(gameHeight - 3); // maxHeight 전달
-            if (sentenceManager->getTimePanalty())
-            {
-                gameManager->applyTimePenalty();
-                sentenceManager->setTimePanalty(false);
-            }
-            sentenceManager->advanceItemBoxes(gameHeight - 3);
-        }
-
-        // 단어 생성 처리 (8개 제한 및 완성 체크)
-        gameManager->handleWordGeneration(sentenceManager);
-
-        // 게임 종료 조건 확인
-        if (gameManager->checkGameEnd())
+        session->tick();
+        if (session->isFinished())
         {
             gameRunning = false;
         }
+        snowfall.advance(GameClock::nowMillis());
 
-        // 전체 프레임 그리기
-        drawFrame();
-
-        // 게임 영역 배경 효과
-        drawBackgroundEffect();
-
-        // 아이템 효과 알림 (3초간 강조 표시)
-        if (gameManager->shouldDisplayItemEffect())
+        // 2. 바뀐 영역만 다시 그리고 한 번에 내보내기
+        auto drawStart = std::chrono::steady_clock::now();
+        drawPanels();
         {
-            attron(COLOR_PAIR(4) | A_BOLD);
-            mvprintw(4, 2, "*** %s ***", gameManager->getLastItemEffectMessage().c_str());
-            attroff(COLOR_PAIR(4) | A_BOLD);
+            TraceSpan refreshSpan("refresh", session->getId());
+            target->flush();
         }
-
-        // 게임 영역 내용 (왼쪽) - 배경만
-        for (int row = 3; row < gameHeight - 2; row++)
+        if (mirrorFrame)
         {
-            for (int col = 1; col < gameAreaWidth; col++)
-            {
-                if (row == 5 || row == gameHeight - 5)
-                {
-                    if (col % 8 == 0)
-                    {
-                        attron(COLOR_PAIR(3));
-                        mvprintw(row, col, "*"); // 눈송이
-                        attroff(COLOR_PAIR(3));
-                    }
-                }
-                else if (col % 15 == 0 && row % 6 == 0)
-                {
-                    attron(COLOR_PAIR(3));
-                    mvprintw(row, col, "~"); // 눈 내리는 효과
-                    attroff(COLOR_PAIR(3));
-                }
-                else if (row == gameHeight - 4 && col % 12 == 0)
-                {
-                    attron(COLOR_PAIR(4));
-                    mvprintw(row, col, "X"); // 목표물
-                    attroff(COLOR_PAIR(4));
-                }
-            }
+            spectatorFeed.publish(*mirrorFrame);
+            recorder.record(*mirrorFrame);
         }
-
-        // 단어 블록 렌더링 (배경보다 먼저 그려서 덮어씌우기)
-        attron(COLOR_PAIR(6) | A_BOLD);
-        const auto &wordBlocks = sentenceManager->getWordBlocks();
-        for (const auto &block : wordBlocks)
-        {
-            // active 체크와 화면 범위 체크
-            if (block.active && block.getY() >= 3 && block.getY() < gameHeight - 2)
-            {
-                int blockX = block.getX();
-                int blockY = block.getY();
-
-                // 단어가 화면 범위 내에 있는지 확인
-                if (blockX >= 1 && blockX + (int)block.word.length() < gameAreaWidth - 1)
-                {
-                    mvprintw(blockY, blockX, "%s", block.word.c_str());
-                }
-            }
-        }
-        attroff(COLOR_PAIR(6) | A_BOLD);
-
-        // 아이템 박스 렌더링
-        attron(COLOR_PAIR(4) | A_BOLD);
-        const auto &itemBoxes = sentenceManager->getItemBoxes();
-        for (const auto &box : itemBoxes)
-        {
-            if (box.getIsActive() && box.getY() >= 3 && box.getY() < gameHeight - 2)
-            {
-                int boxX = box.getX();
-                int boxY = box.getY();
-
-                if (boxX >= 1 && boxX + 2 < gameAreaWidth - 1)
-                {
-                    mvprintw(boxY, boxX, "[?]");
-                }
-            }
-        }
-        attroff(COLOR_PAIR(4) | A_BOLD);
-
-        // 오른쪽 영역 (수정된 drawInfoPanel 호출)
-        drawInfoPanel();
-
-        refresh();
+        latencyTracer.framePresented();
+        int64_t drawNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - drawStart).count();
+        SNOWMAN_PROBE2(frame_present, session->getId(), drawNanos);
+        GameMetrics::get().framesRendered.add();
+        GameMetrics::get().frameSeconds.record(static_cast<uint64_t>(drawNanos));
     }
 
     void shapeScreen() override
@@ -539,64 +713,66 @@ public:
 
     void runPlayScreen()
     {
-        int key;
+        // 한 프레임 동안 쌓인 키 (붙여넣기처럼 더 많이 쌓이면 나머지는 다음 프레임에)
+        int keys[MAX_KEYS_PER_FRAME];
         while (gameRunning)
         {
             UpdateScreen();
-            timeout(50);
-            key = ::getch();
-
+            // 다음 타이머(낙하/생성/시계) 또는 눈이 움직일 때까지 대기, 키가 들어오면 바로 깸
+            int wait = session->millisUntilNextEvent();
+            int snowWait = snowfall.millisUntilNextFrame(GameClock::nowMillis());
+            timeout(snowWait >= 0 && snowWait < wait ? snowWait : wait);
+            int key = ::getch();
+
+            // 첫 키 뒤에 이미 들어와 있는 키는 기다리지 않고 모두 꺼내 한 묶음으로 처리
+            int count = 0;
             if (key != ERR)
             {
-                switch (key)
+                timeout(0);
+            }
+            while (key != ERR)
+            {
+                latencyTracer.keyRead(key);
+                SNOWMAN_PROBE2(key_read, session->getId(), key);
+                if (key == 27) // ESC
                 {
-                case 27: // ESC
                     gameRunning = false;
                     break;
-                case '\t': // TAB
-                case KEY_DOWN:
-                    sentenceManager->getInputHandler()->nextInput();
-                    break;
-                case KEY_UP:
-                    sentenceManager->getInputHandler()->previousInput();
-                    break;
-                default:
-                {
-                    auto handler = sentenceManager->getInputHandler();
-                    int beforeIndex = handler->getCurrentInputIndex();
-                    if (handler->handleInput(key))
-                    {
-                        int usedIndex = beforeIndex;
-                        std::string submitted = handler->getInputAt(usedIndex);
-
-                        std::string lowered = submitted;
-                        std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
-                        if (lowered == "random")
-                        {
-                            ItemBox::ItemType type;
-                            if (sentenceManager->tryUseActiveItemBox(type))
-                            {
-                                gameManager->applyItemEffect(type);
-                                handler->clearInput(usedIndex);
-                            }
-                        }
-
-                        sentenceManager->checkAnswers();
-                    }
                 }
-                break;
+                keys[count++] = key;
+                if (count == MAX_KEYS_PER_FRAME)
+                {
+                    break;
                 }
+                key = ::getch();
             }
+
+            // 정답 확인은 묶음마다 한 번, 화면은 다음 UpdateScreen 에서 한 번만 다시 그림
+            session->handleKeys(keys, count);
         }
 
-        gameManager->endGame();
-        clear();
-        attron(COLOR_PAIR(1) | A_BOLD);
-        mvprintw(gameHeight / 2 - 3, gameWidth / 2 - 15, "GAME OVER");
-        mvprintw(gameHeight / 2 - 1, gameWidth / 2 - 20, "Final Score: %d", gameManager->getTotalScore());
-        mvprintw(gameHeight / 2 + 3, gameWidth / 2 - 15, "Press any key to exit...");
-        attroff(COLOR_PAIR(1) | A_BOLD);
-        refresh();
+        session->end();
+        latencyTracer.exportSession(session->getId(), currentLevel);
+        FrameTrace::get().writeFile(session->getId());
+        target->clear();
+        target->attrOn(COLOR_PAIR(1) | A_BOLD);
+        target->print(gameHeight / 2 - 3, gameWidth / 2 - 15, "GAME OVER");
+        target->print(gameHeight / 2 - 1, gameWidth / 2 - 20, "Final Score: %d", gameManager->getTotalScore());
+        if (leaderboard && leaderboard->submit(currentLevel, gameManager->getTotalScore()))
+        {
+            leaderboard->refresh();
+            target->print(gameHeight / 2 + 1, gameWidth / 2 - 20, "Rank: #%d of %d (Level %d)",
+                     leaderboard->rankOf(currentLevel, gameManager->getTotalScore()),
+                     leaderboard->countOf(currentLevel), currentLevel);
+        }
+        target->print(gameHeight / 2 + 3, gameWidth / 2 - 15, "Press any key to exit...");
+        target->attrOff(COLOR_PAIR(1) | A_BOLD);
+        target->present();
+        if (mirrorFrame)
+        {
+            spectatorFeed.publish(*mirrorFrame);
+            recorder.record(*mirrorFrame);
+        }
         timeout(-1);
         ::getch();
         endwin();
@@ -608,9 +784,37 @@ class InitialScreen : public Screen
 private:
     int selectedLevel;
     bool playButtonPressed;
+    Leaderboard leaderboard;
+    CursesTarget cursesTarget;
+    RenderTarget *target;
+    bool ownsTerminal;
+
+    static const int TOP_SCORES = 5; // 레벨 선택 화면에 보여 줄 순위 수
+
+    // 선택한 레벨의 상위 점수
+    void drawTopScores()
+    {
+        std::vector<ScoreEntry> top = leaderboard.topK(selectedLevel, TOP_SCORES);
+        target->attrOn(COLOR_PAIR(1));
+        target->print(22, 28, "TOP SCORES - Level %d", selectedLevel);
+        target->attrOff(COLOR_PAIR(1));
+        target->attrOn(COLOR_PAIR(3));
+        if (top.empty())
+        {
+            target->print(23, 30, "(no scores yet)");
+        }
+        for (size_t i = 0; i < top.size(); i++)
+        {
+            time_t when = static_cast<time_t>(top[i].timestamp);
+            char date[16];
+            strftime(date, sizeof(date), "%Y-%m-%d", localtime(&when));
+            target->print(23 + static_cast<int>(i), 26, "%d. %6d   %s", static_cast<int>(i) + 1, top[i].score, date);
+        }
+        target->attrOff(COLOR_PAIR(3));
+    }
 
 public:
-    InitialScreen() : selectedLevel(1), playButtonPressed(false)
+    InitialScreen() : selectedLevel(1), playButtonPressed(false), target(&cursesTarget), ownsTerminal(true)
     {
         setlocale(LC_ALL, "");
         initscr();
@@ -628,46 +832,63 @@ public:
         }
     }
 
-    ~InitialScreen() { endwin(); }
+    // 터미널 없이 renderTarget 에 메뉴만 그리는 화면 (골든 프레임 테스트)
+    explicit InitialScreen(RenderTarget &renderTarget)
+        : selectedLevel(1), playButtonPressed(false), target(&renderTarget), ownsTerminal(false) {}
 
-    void UpdateScreen() override
+    ~InitialScreen()
     {
-        clear();
-        attron(COLOR_PAIR(1) | A_BOLD);
-        mvprintw(2, 15, "  _____ _   _  _____  _    _   __  __          _   _ ");
-        mvprintw(3, 15, " / ____| \\ | |/ _ \\ \\| |  | | |  \\/  |   /\\   | \\ | |");
-        mvprintw(4, 15, "| (___ |  \\| | | | | | |  | | | |\\/| |  /  \\  |  \\| |");
-        mvprintw(5, 15, " \\___ \\| . ` | | | | | |/\\| | | |  | | / /\\ \\ | . ` |");
-        mvprintw(6, 15, " ____) | |\\  | |_| | \\  /\\  / | |  | |/ ____ \\| |\\  |");
-        mvprintw(7, 15, "|_____/|_| \\_|\\___/ \\_\\/  \\/  |_|  |_/_/    \\_\\_| \\_|");
-        attroff(COLOR_PAIR(1) | A_BOLD);
+        if (ownsTerminal)
+        {
+            endwin();
+        }
+    }
 
-        attron(COLOR_PAIR(1));
-        mvprintw(9, 20, "*** WELCOME TO SNOW MAN GAME ***");
-        attroff(COLOR_PAIR(1));
+    void selectLevel(int level)
+    {
+        if (level >= 1 && level <= 3)
+            selectedLevel = level;
+    }
 
-        mvprintw(12, 30, "SELECT LEVEL:");
+    void UpdateScreen() override
+    {
+        target->clear();
+        target->attrOn(COLOR_PAIR(1) | A_BOLD);
+        target->print(2, 15, "  _____ _   _  _____  _    _   __  __          _   _ ");
+        target->print(3, 15, " / ____| \\ | |/ _ \\ \\| |  | | |  \\/  |   /\\   | \\ | |");
+        target->print(4, 15, "| (___ |  \\| | | | | | |  | | | |\\/| |  /  \\  |  \\| |");
+        target->print(5, 15, " \\___ \\| . ` | | | | | |/\\| | | |  | | / /\\ \\ | . ` |");
+        target->print(6, 15, " ____) | |\\  | |_| | \\  /\\  / | |  | |/ ____ \\| |\\  |");
+        target->print(7, 15, "|_____/|_| \\_|\\___/ \\_\\/  \\/  |_|  |_/_/    \\_\\_| \\_|");
+        target->attrOff(COLOR_PAIR(1) | A_BOLD);
+
+        target->attrOn(COLOR_PAIR(1));
+        target->print(9, 20, "*** WELCOME TO SNOW MAN GAME ***");
+        target->attrOff(COLOR_PAIR(1));
+
+        target->print(12, 30, "SELECT LEVEL:");
 
         for (int i = 1; i <= 3; i++)
         {
             if (selectedLevel == i)
             {
-                attron(COLOR_PAIR(2) | A_BOLD);
-                mvprintw(13 + i, 25, ">>> [%d] Level %d - %s <<<", i, i, (i == 1 ? "Easy" : i == 2 ? "Medium" : "Hard"));
-                attroff(COLOR_PAIR(2) | A_BOLD);
+                target->attrOn(COLOR_PAIR(2) | A_BOLD);
+                target->print(13 + i, 25, ">>> [%d] Level %d - %s <<<", i, i, (i == 1 ? "Easy" : i == 2 ? "Medium" : "Hard"));
+                target->attrOff(COLOR_PAIR(2) | A_BOLD);
             }
             else
             {
-                attron(COLOR_PAIR(3));
-                mvprintw(13 + i, 29, "[%d] Level %d - %s", i, i, (i == 1 ? "Easy" : i == 2 ? "Medium" : "Hard"));
-                attroff(COLOR_PAIR(3));
+                target->attrOn(COLOR_PAIR(3));
+                target->print(13 + i, 29, "[%d] Level %d - %s", i, i, (i == 1 ? "Easy" : i == 2 ? "Medium" : "Hard"));
+                target->attrOff(COLOR_PAIR(3));
             }
         }
-        attron(COLOR_PAIR(3));
-        mvprintw(18, 32, "[P] PLAY GAME");
-        mvprintw(19, 34, "[Q] QUIT");
-        attroff(COLOR_PAIR(3));
-        refresh();
+        target->attrOn(COLOR_PAIR(3));
+        target->print(18, 32, "[P] PLAY GAME");
+        target->print(19, 34, "[Q] QUIT");
+        target->attrOff(COLOR_PAIR(3));
+        drawTopScores();
+        target->present();
     }
 
     void resizeScreen() override {}
@@ -704,9 +925,12 @@ public:
                 playButtonPressed = true;
                 {
                     endwin();
-                    PlayScreen *pScreen = new PlayScreen(selectedLevel);
+                    // SNOWMAN_DICT 파일을 다시 컴파일했으면 이번 게임부터 새 코퍼스 사용
+                    Corpus::reloadIfChanged();
+                    PlayScreen *pScreen = new PlayScreen(selectedLevel, &leaderboard);
                     pScreen->runPlayScreen();
                     delete pScreen;
+                    leaderboard.refresh();
                     initscr();
                     noecho();
                     cbreak();
@@ -721,6 +945,7 @@ public:
                 break;
             case 'Q':
             case 'q':
+                leaderboard.flush();
                 endwin();
                 exit(0);
                 break;
@@ -0,0 +1,298 @@
+// level_tuner: 레벨 밸런스 수치를 격자로 바꿔 가며 봇 게임을 대량으로 돌리는 몬테카를로 튜너
+//
+// 사용법:
+//   level_tuner [--level L] [--games N] [--batch N] [--threads N] [--tick MS] [--seed S]
+//               [--time-limit 120,150,180] [--create 2,3,4] [--render 1,2]
+//               [--itembox 20,30,40] [--penalty 5,10,15]
+//               [--item-bonus 10] [--item-minus 10] [--score-boost 2]
+//               [--wpm 60] [--wpm-sd 15] [--typo 0.03] [--reaction 400]
+//               [--win-snowmen 3] [--out surface.csv]
+//
+// 지정하지 않은 수치는 레벨 기본값(GameTuning::forLevel) 하나로 고정된다.
+// 게임마다 봇의 WPM 을 정규분포에서 뽑아 여러 실력의 플레이어를 흉내 낸다.
+// 게임 하나의 난수(봇 WPM, 세션, 봇)는 (--seed, 격자 점 안의 게임 번호)로만 정해지므로
+// 스레드 수, --batch, 작업 훔치기 순서와 상관없이 같은 결과가 나오고, 격자 점끼리는 같은 게임들로 비교된다.
+// 결과 CSV 한 줄 = 격자 한 점 (승률, 평균/표준편차 점수, 평균 눈사람 수) -> 승률/점수 곡면
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o level_tuner level_tuner.cpp SentenceManager.cpp Dictionary.cpp SnowDict.cpp -lncurses
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "BotGame.h"
+#include "GameTuning.h"
+#include "TypistBot.h"
+#include "WorkStealingPool.h"
+
+struct TunerOptions
+{
+    int level = 1;
+    int games = 10000; // 격자 한 점당 게임 수
+    int batch = 250;   // 작업 하나에 들어가는 게임 수
+    int threads = 0;
+    int tickMillis = 50;
+    uint32_t seed = 12345;
+    double wpmMean = 60.0;
+    double wpmStddev = 15.0;
+    int winSnowmen = 3; // 이만큼 눈사람을 모으면 승리로 침
+    TypistBot::Profile profile;
+    std::string outPath;
+
+    std::vector<int> timeLimits;
+    std::vector<double> createIntervals;
+    std::vector<int> renderIntervals;
+    std::vector<double> itemBoxIntervals;
+    std::vector<int> penalties;
+    std::vector<int> itemBonuses;
+    std::vector<int> itemMinuses;
+    std::vector<int> scoreBoosts;
+};
+
+// 격자 한 점의 누적 결과
+struct GridPoint
+{
+    GameTuning tuning;
+    std::mutex lock;
+    uint64_t games = 0;
+    uint64_t wins = 0;
+    uint64_t rounds = 0; // 완성한 문장 수
+    double scoreSum = 0.0;
+    double scoreSquareSum = 0.0;
+};
+
+template <typename T>
+static std::vector<T> parseList(const char *text)
+{
+    std::vector<T> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+        {
+            values.push_back(static_cast<T>(atof(item.c_str())));
+        }
+    }
+    return values;
+}
+
+template <typename T>
+static const std::vector<T> &orDefault(std::vector<T> &values, T fallback)
+{
+    if (values.empty())
+    {
+        values.push_back(fallback);
+    }
+    return values;
+}
+
+// 격자의 모든 조합 생성
+static std::vector<GameTuning> buildGrid(TunerOptions &options)
+{
+    GameTuning base = GameTuning::forLevel(options.level);
+    std::vector<GameTuning> grid;
+    for (int timeLimit : orDefault(options.timeLimits, base.timeLimit))
+        for (double create : orDefault(options.createIntervals, base.wordCreateInterval))
+            for (int render : orDefault(options.renderIntervals, base.wordRenderInterval))
+                for (double itemBox : orDefault(options.itemBoxIntervals, base.itemBoxInterval))
+                    for (int penalty : orDefault(options.penalties, base.timePenaltySeconds))
+                        for (int bonus : orDefault(options.itemBonuses, base.itemTimeBonus))
+                            for (int minus : orDefault(options.itemMinuses, base.itemTimeMinus))
+                                for (int boost : orDefault(options.scoreBoosts, base.itemScoreMultiplier))
+                                {
+                                    GameTuning tuning = base;
+                                    tuning.timeLimit = timeLimit;
+                                    tuning.wordCreateInterval = create;
+                                    tuning.wordRenderInterval = render;
+                                    tuning.itemBoxInterval = itemBox;
+                                    tuning.timePenaltySeconds = penalty;
+                                    tuning.itemTimeBonus = bonus;
+                                    tuning.itemTimeMinus = minus;
+                                    tuning.itemScoreMultiplier = boost;
+                                    grid.push_back(tuning);
+                                }
+    return grid;
+}
+
+// 작업 하나: 격자 한 점에서 firstGame 번째부터 게임 count 판
+static void runBatch(const TunerOptions &options, GridPoint &point, int firstGame, int count)
+{
+    uint64_t wins = 0;
+    uint64_t rounds = 0;
+    double scoreSum = 0.0;
+    double scoreSquareSum = 0.0;
+
+    for (int i = 0; i < count; i++)
+    {
+        std::seed_seq sequence{options.seed, static_cast<uint32_t>(firstGame + i)};
+        std::mt19937 rng(sequence);
+        std::normal_distribution<double> wpm(options.wpmMean, options.wpmStddev);
+
+        TypistBot::Profile profile = options.profile;
+        profile.wordsPerMinute = std::max(10.0, wpm(rng));
+
+        BotGameResult result = runBotGame(options.level, point.tuning, profile, static_cast<uint32_t>(rng()),
+                                          options.tickMillis);
+        double score = static_cast<double>(result.score);
+        scoreSum += score;
+        scoreSquareSum += score * score;
+        rounds += static_cast<uint64_t>(result.snowmen);
+        if (result.snowmen >= options.winSnowmen)
+        {
+            wins++;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(point.lock);
+    point.games += static_cast<uint64_t>(count);
+    point.wins += wins;
+    point.rounds += rounds;
+    point.scoreSum += scoreSum;
+    point.scoreSquareSum += scoreSquareSum;
+}
+
+static void printUsage()
+{
+    std::cerr << "usage: level_tuner [--level L] [--games N] [--batch N] [--threads N] [--tick MS] [--seed S]\n"
+                 "                   [--time-limit a,b,..] [--create a,b,..] [--render a,b,..] [--itembox a,b,..]\n"
+                 "                   [--penalty a,b,..] [--item-bonus a,b,..] [--item-minus a,b,..] [--score-boost a,b,..]\n"
+                 "                   [--wpm W] [--wpm-sd S] [--typo P] [--reaction MS] [--win-snowmen K] [--out file.csv]"
+              << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    TunerOptions options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        const char *value = argv[++i];
+        if (arg == "--level")
+            options.level = atoi(value);
+        else if (arg == "--games")
+            options.games = atoi(value);
+        else if (arg == "--batch")
+            options.batch = std::max(1, atoi(value));
+        else if (arg == "--threads")
+            options.threads = atoi(value);
+        else if (arg == "--tick")
+            options.tickMillis = std::max(1, atoi(value));
+        else if (arg == "--seed")
+            options.seed = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        else if (arg == "--time-limit")
+            options.timeLimits = parseList<int>(value);
+        else if (arg == "--create")
+            options.createIntervals = parseList<double>(value);
+        else if (arg == "--render")
+            options.renderIntervals = parseList<int>(value);
+        else if (arg == "--itembox")
+            options.itemBoxIntervals = parseList<double>(value);
+        else if (arg == "--penalty")
+            options.penalties = parseList<int>(value);
+        else if (arg == "--item-bonus")
+            options.itemBonuses = parseList<int>(value);
+        else if (arg == "--item-minus")
+            options.itemMinuses = parseList<int>(value);
+        else if (arg == "--score-boost")
+            options.scoreBoosts = parseList<int>(value);
+        else if (arg == "--wpm")
+            options.wpmMean = atof(value);
+        else if (arg == "--wpm-sd")
+            options.wpmStddev = atof(value);
+        else if (arg == "--typo")
+            options.profile.typoRate = atof(value);
+        else if (arg == "--reaction")
+            options.profile.reactionMillis = atoi(value);
+        else if (arg == "--win-snowmen")
+            options.winSnowmen = atoi(value);
+        else if (arg == "--out")
+            options.outPath = value;
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::vector<GameTuning> grid = buildGrid(options);
+    std::vector<std::unique_ptr<GridPoint>> points;
+    for (const GameTuning &tuning : grid)
+    {
+        points.emplace_back(new GridPoint());
+        points.back()->tuning = tuning;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(options.threads);
+        for (auto &point : points)
+        {
+            for (int done = 0; done < options.games; done += options.batch)
+            {
+                int count = std::min(options.batch, options.games - done);
+                GridPoint *target = point.get();
+                pool.submit([&options, target, done, count]()
+                            { runBatch(options, *target, done, count); });
+            }
+        }
+        pool.wait();
+        std::cerr << "level_tuner: " << grid.size() << " configurations x " << options.games << " games on "
+                  << pool.getThreadCount() << " threads";
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    uint64_t totalGames = 0;
+    uint64_t totalRounds = 0;
+    for (const auto &point : points)
+    {
+        totalGames += point->games;
+        totalRounds += point->rounds;
+    }
+    std::cerr << " in " << std::fixed << std::setprecision(2) << seconds << " s ("
+              << std::setprecision(0) << totalGames / seconds << " games/s, "
+              << totalRounds / seconds << " rounds/s)" << std::endl;
+
+    std::ofstream file;
+    if (!options.outPath.empty())
+    {
+        file.open(options.outPath);
+        if (!file)
+        {
+            std::cerr << "level_tuner: cannot write " << options.outPath << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = options.outPath.empty() ? std::cout : file;
+    out << std::fixed;
+
+    out << "time_limit,create_interval,render_interval,itembox_interval,penalty,"
+           "item_bonus,item_minus,score_boost,games,win_rate,mean_score,score_stddev,mean_snowmen\n";
+    for (const auto &point : points)
+    {
+        const GameTuning &t = point->tuning;
+        double games = static_cast<double>(std::max<uint64_t>(1, point->games));
+        double mean = point->scoreSum / games;
+        double variance = std::max(0.0, point->scoreSquareSum / games - mean * mean);
+        out << t.timeLimit << ',' << std::setprecision(2) << t.wordCreateInterval << ',' << t.wordRenderInterval << ','
+            << t.itemBoxInterval << ',' << t.timePenaltySeconds << ',' << t.itemTimeBonus << ','
+            << t.itemTimeMinus << ',' << t.itemScoreMultiplier << ',' << point->games << ','
+            << std::setprecision(4) << static_cast<double>(point->wins) / games << ','
+            << std::setprecision(1) << mean << ',' << std::sqrt(variance) << ','
+            << std::setprecision(3) << static_cast<double>(point->rounds) / games << '\n';
+    }
+    return 0;
+}
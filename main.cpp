@@ -2,9 +2,15 @@
 #include <stdlib.h>
 
 #include "interface.h"
+#include "Metrics.h"
 
 int main()
 {
+    // SNOWMAN_METRICS_SOCKET 에 경로가 있으면 메트릭을 Unix 소켓으로 내보냄
+    // (Q 로 종료할 때 exit() 이 정리하도록 static)
+    static MetricsExporter metricsExporter;
+    metricsExporter.start(getenv("SNOWMAN_METRICS_SOCKET"));
+
     InitialScreen initialScreen = InitialScreen();
     initialScreen.UpdateScreen();
     initialScreen.runInitialScreen();
@@ -0,0 +1,150 @@
+// snowdict-compile: 텍스트 코퍼스를 .snowdict 바이너리로 변환하는 오프라인 도구
+//
+// 사용법:
+//   snowdict-compile -o corpus.snowdict [--builtin] [corpus.txt ...]
+//
+// 코퍼스 텍스트 형식: 한 줄에 "<레벨> <문장>" (구분자는 공백 또는 탭)
+//   1	The bright morning sun warmed the quiet village
+//   # 으로 시작하는 줄과 빈 줄은 무시
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o snowdict-compile snowdict_compile.cpp SnowDict.cpp Dictionary.cpp
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include "Dictionary.h"
+#include "SnowDict.h"
+
+static void printUsage()
+{
+    std::cerr << "usage: snowdict-compile -o <out.snowdict> [--builtin] [corpus.txt ...]" << std::endl;
+}
+
+// "<레벨> <문장>" 한 줄 해석
+static bool parseLine(const std::string &line, int &level, std::string &sentence)
+{
+    size_t pos = 0;
+    while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t'))
+    {
+        pos++;
+    }
+    if (pos >= line.size() || line[pos] == '#')
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    long value = strtol(line.c_str() + pos, &end, 10);
+    if (end == line.c_str() + pos || (*end != ' ' && *end != '\t'))
+    {
+        return false;
+    }
+
+    sentence = end;
+    sentence.erase(0, sentence.find_first_not_of(" \t"));
+    while (!sentence.empty() && (sentence.back() == '\r' || sentence.back() == ' ' || sentence.back() == '\t'))
+    {
+        sentence.pop_back();
+    }
+    level = static_cast<int>(value);
+    return !sentence.empty();
+}
+
+int main(int argc, char **argv)
+{
+    std::string outPath;
+    bool includeBuiltin = false;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc)
+        {
+            outPath = argv[++i];
+        }
+        else if (arg == "--builtin")
+        {
+            includeBuiltin = true;
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            printUsage();
+            return 0;
+        }
+        else
+        {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (outPath.empty() || (inputs.empty() && !includeBuiltin))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::map<int, std::vector<std::string>> levelSentences;
+
+    if (includeBuiltin)
+    {
+        Dictionary builtin(""); // 빈 경로 -> 내장 문장
+        for (const auto &entry : builtin.getLevelSentences())
+        {
+            auto &target = levelSentences[entry.first];
+            target.insert(target.end(), entry.second.begin(), entry.second.end());
+        }
+    }
+
+    int malformed = 0;
+    for (const std::string &inputPath : inputs)
+    {
+        std::ifstream in(inputPath);
+        if (!in)
+        {
+            std::cerr << "snowdict-compile: cannot open " << inputPath << std::endl;
+            return 1;
+        }
+
+        std::string line;
+        int level = 0;
+        std::string sentence;
+        while (std::getline(in, line))
+        {
+            if (parseLine(line, level, sentence))
+            {
+                levelSentences[level].push_back(sentence);
+            }
+            else if (line.find_first_not_of(" \t\r") != std::string::npos && line[line.find_first_not_of(" \t")] != '#')
+            {
+                malformed++;
+            }
+        }
+    }
+
+    int skipped = 0;
+    std::string error;
+    if (!SnowDict::write(outPath, levelSentences, Dictionary::WORDS_PER_SENTENCE, skipped, error))
+    {
+        std::cerr << "snowdict-compile: " << error << std::endl;
+        return 1;
+    }
+
+    // 결과 요약
+    Dictionary check(outPath);
+    std::cout << "wrote " << outPath << std::endl;
+    for (const auto &entry : levelSentences)
+    {
+        std::cout << "  level " << entry.first << ": " << check.getSentenceCount(entry.first) << " sentences" << std::endl;
+    }
+    if (skipped > 0)
+    {
+        std::cout << "  skipped " << skipped << " sentences without " << Dictionary::WORDS_PER_SENTENCE << " words" << std::endl;
+    }
+    if (malformed > 0)
+    {
+        std::cout << "  ignored " << malformed << " malformed lines" << std::endl;
+    }
+    return 0;
+}
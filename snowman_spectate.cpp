@@ -0,0 +1,176 @@
+// snowman-spectate: 실행 중인 게임 화면을 관전하는 뷰어
+//
+// 사용법:
+//   snowman-spectate <소켓 경로> [--dump N]
+//
+// 게임을 SNOWMAN_SPECTATE_SOCKET=<소켓 경로> 로 실행하면 그 화면을 그대로 따라 그린다 (q 로 종료).
+// --dump N: 터미널 없이 메시지 N 개를 받은 뒤 마지막 화면과 통계를 표준 출력에 씀 (확인용)
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o snowman-spectate snowman_spectate.cpp -lncurses
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "SpectatorFeed.h"
+
+static const int SCREEN_ROWS = 50;
+static const int SCREEN_COLS = 120;
+
+static int connectFeed(const char *path)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path))
+    {
+        return -1;
+    }
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 받은 화면을 터미널에 (curses 가 바뀐 칸만 내보냄)
+static void drawFrame(const FrameBuffer &frame)
+{
+    for (int y = 0; y < frame.getHeight() && y < LINES; y++)
+    {
+        for (int x = 0; x < frame.getWidth() && x < COLS; x++)
+        {
+            const FrameBuffer::Cell &cell = frame.at(y, x);
+            mvaddch(y, x, static_cast<chtype>(static_cast<unsigned char>(cell.glyph)) | cell.attrs | COLOR_PAIR(cell.pair));
+        }
+    }
+    refresh();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: snowman-spectate <socket> [--dump N]" << std::endl;
+        return 1;
+    }
+    const char *path = argv[1];
+    int dumpCount = 0;
+    if (argc >= 4 && strcmp(argv[2], "--dump") == 0)
+    {
+        dumpCount = atoi(argv[3]);
+    }
+
+    int fd = connectFeed(path);
+    if (fd < 0)
+    {
+        std::cerr << "snowman-spectate: cannot connect to " << path << std::endl;
+        return 1;
+    }
+
+    FrameBuffer frame(SCREEN_ROWS, SCREEN_COLS);
+    std::vector<uint8_t> message(SpectatorFeed::maxMessageSize(SCREEN_ROWS, SCREEN_COLS));
+
+    if (dumpCount == 0)
+    {
+        initscr();
+        noecho();
+        cbreak();
+        curs_set(0);
+        nodelay(stdscr, TRUE);
+        if (has_colors())
+        {
+            // PlayScreen 과 같은 색 쌍
+            start_color();
+            init_pair(1, COLOR_WHITE, COLOR_BLUE);
+            init_pair(2, COLOR_YELLOW, COLOR_BLACK);
+            init_pair(3, COLOR_WHITE, COLOR_BLACK);
+            init_pair(4, COLOR_RED, COLOR_BLACK);
+            init_pair(5, COLOR_CYAN, COLOR_BLACK);
+            init_pair(6, COLOR_GREEN, COLOR_BLACK);
+        }
+    }
+
+    int received = 0;
+    int keyframes = 0;
+    int gaps = 0;
+    long long bytes = 0;
+    int64_t lastSeq = -1;
+    bool waitingForKeyframe = true; // 처음과 번호가 건너뛴 뒤에는 키프레임부터
+    while (dumpCount == 0 || received < dumpCount)
+    {
+        pollfd waiting[2] = {{fd, POLLIN, 0}, {STDIN_FILENO, POLLIN, 0}};
+        if (poll(waiting, dumpCount == 0 ? 2 : 1, -1) < 0)
+        {
+            break;
+        }
+        if (dumpCount == 0 && (waiting[1].revents & POLLIN) && getch() == 'q')
+        {
+            break;
+        }
+        if (!(waiting[0].revents & (POLLIN | POLLHUP)))
+        {
+            continue;
+        }
+
+        ssize_t length = recv(fd, message.data(), message.size(), 0);
+        if (length <= 0)
+        {
+            break; // 게임 종료
+        }
+        SpectatorHeader header;
+        if (static_cast<size_t>(length) < sizeof(header))
+        {
+            continue;
+        }
+        memcpy(&header, message.data(), sizeof(header));
+        if (lastSeq >= 0 && header.seq != static_cast<uint32_t>(lastSeq + 1))
+        {
+            gaps++;
+            waitingForKeyframe = true;
+        }
+        lastSeq = header.seq;
+        if (waitingForKeyframe && header.type != SpectatorFeed::KEYFRAME)
+        {
+            continue;
+        }
+        waitingForKeyframe = false;
+        if (!SpectatorFeed::apply(message.data(), static_cast<size_t>(length), frame))
+        {
+            continue;
+        }
+        received++;
+        keyframes += header.type == SpectatorFeed::KEYFRAME;
+        bytes += length;
+        if (dumpCount == 0)
+        {
+            drawFrame(frame);
+        }
+    }
+
+    if (dumpCount == 0)
+    {
+        endwin();
+    }
+    else
+    {
+        for (int y = 0; y < frame.getHeight(); y++)
+        {
+            std::cout << frame.rowText(y) << "\n";
+        }
+    }
+    std::cout << "messages " << received << " (keyframes " << keyframes << ", gaps " << gaps << "), "
+              << bytes << " bytes" << std::endl;
+    close(fd);
+    return 0;
+}
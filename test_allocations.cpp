@@ -0,0 +1,152 @@
+// 프레임/키 입력 경로가 힙을 쓰지 않는지 확인하는 테스트 (카운팅 할당자)
+// 몇 초 동안 게임을 돌려 용량을 채운 뒤, 그 다음부터는 tick / 키 입력 / 화면에 필요한 값 읽기에서
+// operator new 가 한 번이라도 불리면 실패(1)를 돌려준다.
+// 라운드 전환(새 문장 로드)도 라운드 아레나 안에서만 할당해야 하므로 따로 수천 번 돌려 확인한다.
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_allocations test_allocations.cpp SentenceManager.cpp Dictionary.cpp SnowDict.cpp -lncurses
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "GameSession.h"
+#include "GameClock.h"
+
+static bool countAllocations = false;
+static size_t allocationCount = 0;
+
+void *operator new(size_t size)
+{
+    if (countAllocations)
+        allocationCount++;
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size, std::align_val_t align)
+{
+    if (countAllocations)
+        allocationCount++;
+    size_t alignment = static_cast<size_t>(align);
+    if (void *p = aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment))
+        return p;
+    throw std::bad_alloc();
+}
+
+// malloc/aligned_alloc 으로 받은 메모리이므로 free 가 맞음
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { free(p); }
+
+// 정답이 아닌 글자만 쳐서 라운드가 끝나지 않게 함
+// "random" + Enter (아이템 사용 시도) -> 위로 돌아와 지우기 -> 틀린 단어 + Enter/TAB -> 다시 지우기
+static const int KEY_SCRIPT[] = {'r', 'a', 'n', 'd', 'o', 'm', '\n', KEY_UP,
+                                 KEY_BACKSPACE, KEY_BACKSPACE, KEY_BACKSPACE, 127, 127, 8,
+                                 'x', 'q', 'z', '\n', KEY_UP, 'Q', '\t', KEY_UP,
+                                 KEY_BACKSPACE, KEY_BACKSPACE, KEY_BACKSPACE, KEY_BACKSPACE};
+static const int KEY_SCRIPT_LENGTH = sizeof(KEY_SCRIPT) / sizeof(KEY_SCRIPT[0]);
+
+// 한 프레임에 PlayScreen 이 읽는 값들
+static void readFrameState(GameSession &session, size_t &sink)
+{
+    GameManager *gameManager = session.getGameManager();
+    SentenceManager *sentenceManager = session.getSentenceManager();
+
+    char timeStr[16];
+    gameManager->formatTime(timeStr, sizeof(timeStr));
+    sink += strlen(timeStr);
+    if (gameManager->shouldDisplayItemEffect())
+        sink += strlen(gameManager->getLastItemEffectMessage());
+    for (const auto &block : sentenceManager->getWordBlocks())
+        sink += block.word.length();
+    sink += sentenceManager->getItemBoxes().size();
+    for (const auto &input : sentenceManager->getInputHandler()->getUserInputs())
+        sink += input.size();
+}
+
+int main()
+{
+    std::cout << "=== Allocation Test ===" << std::endl;
+    GameClock::useSimulated(1700000000000LL);
+
+    const int TICK_MILLIS = 50;
+    const int WARMUP_TICKS = 400;   // 20초: 블록/박스/입력 칸 용량 채우기
+    const int MEASURED_TICKS = 2000; // 100초
+
+    size_t sink = 0;
+    int keyIndex = 0;
+    int measuredTicks = 0;
+    size_t itemEffects = 0;
+    {
+        GameSession session(1);
+        for (int tick = 0; tick < WARMUP_TICKS + MEASURED_TICKS && !session.isFinished(); tick++)
+        {
+            if (tick == WARMUP_TICKS)
+            {
+                countAllocations = true;
+            }
+
+            // 두 tick 에 한 번 키 입력
+            if (tick % 2 == 0)
+            {
+                session.handleKey(KEY_SCRIPT[keyIndex]);
+                keyIndex = (keyIndex + 1) % KEY_SCRIPT_LENGTH;
+            }
+            session.tick();
+            readFrameState(session, sink);
+            if (countAllocations)
+            {
+                measuredTicks++;
+                if (session.getGameManager()->shouldDisplayItemEffect())
+                    itemEffects++;
+            }
+            GameClock::advance(TICK_MILLIS);
+        }
+        countAllocations = false;
+    }
+    bool frameOk = allocationCount == 0 && measuredTicks > 0;
+    std::cout << "Measured ticks: " << measuredTicks << " (item effect frames " << itemEffects << ")" << std::endl;
+    std::cout << "Allocations in steady state: " << allocationCount << std::endl;
+    std::cout << "Zero-allocation frame loop: " << (frameOk ? "OK" : "FAILED") << " (" << sink % 10 << ")" << std::endl;
+
+    // 라운드 전환: 끝없이 이어지는 세션에서도 힙 사용량이 늘지 않아야 함
+    const int ROUNDS = 5000;
+    allocationCount = 0;
+    size_t overflowBytes = 0;
+    {
+        GameSession session(2);
+        SentenceManager *sentenceManager = session.getSentenceManager();
+        for (int i = 0; i < 50; i++) // 레벨 샘플러 한 바퀴 이상
+        {
+            session.getGameManager()->prepareNextRound(sentenceManager);
+        }
+        countAllocations = true;
+        for (int i = 0; i < ROUNDS; i++)
+        {
+            // 절반은 눈사람 완성 때처럼 다음 라운드를 미리 준비한 뒤 교체
+            if (i % 2 == 0)
+            {
+                sentenceManager->stageNextRound(2);
+            }
+            session.getGameManager()->prepareNextRound(sentenceManager);
+            for (int w = 0; w < Dictionary::WORDS_PER_SENTENCE; w++)
+            {
+                sentenceManager->createWordBlock(58, sentenceManager->getSpawnOrder()[w]);
+            }
+            sink += sentenceManager->getTargetWords().size();
+        }
+        countAllocations = false;
+        overflowBytes = sentenceManager->getRoundOverflowBytes();
+    }
+    GameClock::useReal();
+
+    bool roundOk = allocationCount == 0 && overflowBytes == 0;
+    std::cout << "Round transitions: " << ROUNDS << ", heap allocations " << allocationCount
+              << ", arena overflow " << overflowBytes << " bytes" << std::endl;
+    std::cout << "Per-round arena: " << (roundOk ? "OK" : "FAILED") << std::endl;
+    return (frameOk && roundOk) ? 0 : 1;
+}
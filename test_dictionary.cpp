@@ -1,5 +1,12 @@
 #include <iostream>
+#include <set>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <map>
 #include "Dictionary.h"
+#include "Tokenizer.h"
 
 int main() {
     Dictionary dict;
@@ -31,5 +38,211 @@ int main() {
     }
     std::cout << std::endl;
     
-    return 0;
+    // 중복 없는 샘플링 테스트: 한 바퀴 안에서는 모든 문장이 한 번씩만 나와야 함
+    std::cout << "\n=== No-Repeat Sampling Test ===" << std::endl;
+    bool samplingOk = true;
+    Dictionary samplingDict; // 위 랜덤 테스트가 바퀴 중간까지 뽑았으므로 새 세션으로 검사
+    for (int level = 1; level <= 3; level++) {
+        bool levelOk = true;
+        int count = samplingDict.getSentenceCount(level);
+        int previous = -1;
+        for (int cycle = 0; cycle < 3; cycle++) {
+            std::set<int> seen;
+            for (int i = 0; i < count; i++) {
+                samplingDict.getRandomSentenceWords(level);
+                int index = samplingDict.getCurrentSentenceIndex();
+                if (!seen.insert(index).second || index == previous) {
+                    levelOk = false;
+                }
+                previous = index;
+            }
+        }
+        std::cout << "Level " << level << ": " << (levelOk ? "OK" : "FAILED") << std::endl;
+        samplingOk = samplingOk && levelOk;
+    }
+    
+    // 큰 레벨에서도 순열인지 확인 (배열 없이 인덱스만 생성)
+    GameRandom samplerRandom(7);
+    SentenceSampler bigSampler(1000003, samplerRandom);
+    std::vector<bool> hit(1000003, false);
+    bool permutationOk = true;
+    for (int i = 0; i < 1000003; i++) {
+        uint32_t index = bigSampler.next(samplerRandom);
+        if (index >= hit.size() || hit[index]) {
+            permutationOk = false;
+            break;
+        }
+        hit[index] = true;
+    }
+    std::cout << "Large permutation: " << (permutationOk ? "OK" : "FAILED") << std::endl;
+    
+    // 컴파일된 .snowdict 코퍼스가 내장 문장과 같은 단어를 돌려주는지 확인
+    std::cout << "\n=== Compiled Dictionary Test ===" << std::endl;
+    Dictionary builtin("");
+    std::string path = "test_dictionary.snowdict";
+    std::string error;
+    int skipped = 0;
+    bool compiledOk = SnowDict::write(path, builtin.getLevelSentences(), Dictionary::WORDS_PER_SENTENCE, skipped, error);
+    Dictionary compiled(path);
+    compiledOk = compiledOk && compiled.isCompiled();
+    for (int level = 1; level <= 3 && compiledOk; level++) {
+        // 8단어가 아닌 문장은 컴파일 시 제외되므로 내장 문장을 건너뛰며 비교
+        int builtinIndex = 0;
+        for (int i = 0; i < compiled.getSentenceCount(level) && compiledOk; i++, builtinIndex++) {
+            while (builtin.getWordsForLevel(level, builtinIndex).size() != Dictionary::WORDS_PER_SENTENCE) {
+                builtinIndex++;
+            }
+            compiledOk = compiled.getWordsForLevel(level, i) == builtin.getWordsForLevel(level, builtinIndex) &&
+                         compiled.getFullSentence(level, i) == builtin.getFullSentence(level, builtinIndex);
+        }
+    }
+    compiledOk = compiledOk && skipped == 1; // Level 2 의 9단어 문장
+    std::cout << "Compiled corpus: " << (compiledOk ? "OK" : "FAILED " + error) << std::endl;
+    
+    // 공유 코퍼스: 세션들이 한 버전을 같이 쓰고, 교체 후에는 새 세션만 새 버전을 씀
+    std::cout << "\n=== Shared Corpus Test ===" << std::endl;
+    setenv("SNOWMAN_DICT", path.c_str(), 1);
+    // 위 세션들은 내장 문장 버전으로 시작했으므로 여기서 파일 버전으로 교체됨
+    bool sharedOk = Corpus::reloadIfChanged() && Corpus::current()->isCompiled() && !dict.isCompiled();
+    Dictionary first;
+    Dictionary second;
+    sharedOk = sharedOk && first.getCorpus() == second.getCorpus() && first.getCorpus() == Corpus::current();
+    sharedOk = sharedOk && !Corpus::reloadIfChanged(); // 파일이 그대로면 교체 없음
+    
+    std::map<int, std::vector<std::string>> smaller = {{1, {builtin.getFullSentence(1, 0)}}};
+    std::string_view oldSentence = first.selectSentence(1, 3);
+    sharedOk = sharedOk && SnowDict::write(path, smaller, Dictionary::WORDS_PER_SENTENCE, skipped, error) &&
+               Corpus::reloadIfChanged();
+    Dictionary third;
+    sharedOk = sharedOk && third.getCorpus() != first.getCorpus() && third.getSentenceCount(1) == 1 &&
+               first.getSentenceCount(1) == compiled.getSentenceCount(1) &&
+               oldSentence == compiled.getFullSentence(1, 3) && // 이전 버전의 문장은 그대로 읽힘
+               third.getCorpus()->getVersion() > first.getCorpus()->getVersion();
+    unsetenv("SNOWMAN_DICT");
+    remove(path.c_str());
+    std::cout << "Corpus reload: " << (sharedOk ? "OK" : "FAILED") << std::endl;
+    
+    // 깨진 .snowdict: 테이블 사이의 번호/범위가 하나라도 틀리면 열지 않음
+    std::cout << "\n=== Corrupt Dictionary Test ===" << std::endl;
+    std::string corruptPath = "test_dictionary_corrupt.snowdict";
+    bool corruptOk = SnowDict::write(corruptPath, builtin.getLevelSentences(), Dictionary::WORDS_PER_SENTENCE, skipped, error);
+    std::string original;
+    if (FILE *file = fopen(corruptPath.c_str(), "rb")) {
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            original.append(buffer, n);
+        }
+        fclose(file);
+    }
+    SnowDictHeader header;
+    memcpy(&header, original.data(), sizeof(header));
+    // 바이트 하나를 덮어쓴(또는 자른) 파일: 0 = 열리지 않음, 1 = 열리지만 어떤 문장의 조회가 실패, 2 = 모두 읽힘
+    // (열 때는 헤더/섹션 범위만 보므로 항목이 깨진 파일은 열리고, 그 항목을 조회할 때 실패해야 함)
+    auto load = [&](const std::string &bytes) {
+        if (FILE *file = fopen(corruptPath.c_str(), "wb")) {
+            fwrite(bytes.data(), 1, bytes.size(), file);
+            fclose(file);
+        }
+        SnowDictView view;
+        std::string openError;
+        if (!view.open(corruptPath, openError)) {
+            return 0;
+        }
+        for (uint32_t l = 0; l < view.getLevelCount(); l++) {
+            int level = view.getLevelAt(l);
+            for (int i = 0; i < view.getSentenceCount(level); i++) {
+                uint32_t sentenceId = view.getSentenceId(level, i);
+                if (sentenceId == UINT32_MAX || view.getText(sentenceId).empty() ||
+                    view.getWordCount(sentenceId) != static_cast<uint32_t>(Dictionary::WORDS_PER_SENTENCE)) {
+                    return 1;
+                }
+                for (uint32_t w = 0; w < view.getWordCount(sentenceId); w++) {
+                    if (view.getWord(sentenceId, w).empty()) {
+                        return 1;
+                    }
+                }
+            }
+        }
+        return 2;
+    };
+    auto patched = [&](uint64_t offset, uint32_t value) {
+        std::string bytes = original;
+        memcpy(&bytes[offset], &value, sizeof(value));
+        return bytes;
+    };
+    corruptOk = corruptOk && load(original) == 2;
+    corruptOk = corruptOk && load(original.substr(0, original.size() - 1)) == 0;                           // 잘린 파일
+    corruptOk = corruptOk && load(patched(offsetof(SnowDictHeader, poolSize), header.poolSize + 8)) == 0; // 헤더 풀 크기
+    corruptOk = corruptOk && load(patched(header.tokenTableOffset, header.stringCount)) == 1;              // 토큰 -> 없는 문자열
+    corruptOk = corruptOk && load(patched(header.stringTableOffset, header.poolSize)) == 1;               // 문자열 오프셋이 풀 밖
+    corruptOk = corruptOk && load(patched(header.stringTableOffset + 4, 0xffff)) == 1;                    // 문자열 길이가 풀 밖
+    corruptOk = corruptOk && load(patched(header.sentenceTableOffset, header.stringCount)) == 1;           // 문장 원문 번호
+    corruptOk = corruptOk && load(patched(header.sentenceTableOffset + 4, header.tokenCount - 4)) == 1;   // 문장 토큰 범위
+    corruptOk = corruptOk && load(patched(header.levelIndexOffset, header.sentenceCount)) == 1;           // 레벨 -> 없는 문장
+    corruptOk = corruptOk && load(patched(header.levelTableOffset + 8, header.sentenceCount + 1)) == 1;   // 레벨 문장 수
+    // Dictionary 를 거친 조회도 깨진 문장은 빈 결과
+    if (FILE *file = fopen(corruptPath.c_str(), "wb")) {
+        std::string bytes = patched(header.sentenceTableOffset + 4, header.tokenCount - 4);
+        fwrite(bytes.data(), 1, bytes.size(), file);
+        fclose(file);
+    }
+    std::shared_ptr<const Corpus> corrupt = Corpus::load(corruptPath, error);
+    int emptySentences = 0;
+    std::vector<std::string> words;
+    for (int i = 0; corrupt && i < corrupt->getLevelCount(); i++) {
+        int level = corrupt->getLevelAt(i);
+        for (int s = 0; s < corrupt->getSentenceCount(level); s++) {
+            corrupt->copyWords(level, s, words);
+            emptySentences += words.empty();
+        }
+    }
+    corruptOk = corruptOk && corrupt && emptySentences == 1;
+    remove(corruptPath.c_str());
+    std::cout << "Corrupt files rejected: " << (corruptOk ? "OK" : "FAILED") << std::endl;
+    
+    // 토크나이저: 모든 분류 방식(스칼라/SSE2/AVX2)이 한 글자씩 나누는 방식과 같은 결과
+    // (64바이트 블록 경계에 걸친 단어, 공백/구두점만 있는 입력, 0x80 이상 바이트 포함)
+    std::cout << "\n=== Tokenizer Test ===" << std::endl;
+    bool tokenizerOk = true;
+    const char alphabet[] = "ab .,!?\t\n\r\v\fXyz-'\x80\xff";
+    srand(7);
+    TokenTable tokens;
+    for (int round = 0; round < 3000 && tokenizerOk; round++) {
+        std::string text;
+        int length = rand() % 300;
+        for (int i = 0; i < length; i++) {
+            text += alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+        std::vector<std::string> expected;
+        std::string word;
+        for (size_t i = 0; i <= text.size(); i++) {
+            unsigned char c = i < text.size() ? text[i] : ' ';
+            if (c == ' ' || (c >= '\t' && c <= '\r')) {
+                if (!word.empty()) {
+                    expected.push_back(word);
+                }
+                word.clear();
+            } else if (c != '.' && c != ',' && c != '!' && c != '?') {
+                word += static_cast<char>(c);
+            }
+        }
+        for (int kernel = TokenTable::KERNEL_SCALAR; kernel <= TokenTable::KERNEL_AVX2; kernel++) {
+            if (!TokenTable::isSupported(static_cast<TokenTable::Kernel>(kernel))) {
+                continue;
+            }
+            tokens.clear();
+            tokenizerOk = tokenizerOk && tokens.tokenize(text, static_cast<TokenTable::Kernel>(kernel)) == expected.size();
+            for (size_t i = 0; tokenizerOk && i < expected.size(); i++) {
+                std::string_view source = tokens.getSource(text, i);
+                tokenizerOk = tokens[i] == expected[i] && !source.empty() && source.find(' ') == std::string_view::npos;
+            }
+        }
+    }
+    tokenizerOk = tokenizerOk && Dictionary::splitSentenceIntoWords("  Hi, there... snow-man!  ") ==
+                                     std::vector<std::string>({"Hi", "there", "snow-man"});
+    std::cout << "Kernel: " << TokenTable::getKernelName(TokenTable::bestKernel()) << std::endl;
+    std::cout << "Tokenizer: " << (tokenizerOk ? "OK" : "FAILED") << std::endl;
+    
+    return (samplingOk && permutationOk && compiledOk && sharedOk && corruptOk && tokenizerOk) ? 0 : 1;
 }
\ No newline at end of file
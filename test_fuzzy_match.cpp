@@ -0,0 +1,169 @@
+// 오타 허용 비교(FuzzyMatcher) 테스트
+// 비트 병렬 거리를 보통의 DP 레벤슈타인 거리와 비교한다.
+// - distance(): 임의의 단어/입력 (대소문자 섞음, 빈 단어, 64자 넘는 단어는 앞 64자)
+// - distances(): 한 글자씩 칠 때(이어서 진행), 백스페이스, 가운데 글자 고침, 64자 넘는 입력, 단어 목록 교체
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_fuzzy_match test_fuzzy_match.cpp
+
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+#include "FuzzyMatch.h"
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+// 기준: O(n*m) DP (대소문자 무시, 단어는 앞 MAX_WORD_LENGTH 자만)
+static int levenshtein(const std::string &word, const std::string &input)
+{
+    std::string a = word.substr(0, FuzzyMatcher::MAX_WORD_LENGTH);
+    std::vector<int> previous(a.size() + 1), current(a.size() + 1);
+    for (size_t j = 0; j <= a.size(); j++)
+        previous[j] = static_cast<int>(j);
+    for (size_t i = 1; i <= input.size(); i++)
+    {
+        current[0] = static_cast<int>(i);
+        for (size_t j = 1; j <= a.size(); j++)
+        {
+            bool same = std::tolower(static_cast<unsigned char>(input[i - 1])) == std::tolower(static_cast<unsigned char>(a[j - 1]));
+            current[j] = std::min({previous[j] + 1, current[j - 1] + 1, previous[j - 1] + (same ? 0 : 1)});
+        }
+        std::swap(previous, current);
+    }
+    return previous[a.size()];
+}
+
+static std::string randomText(std::mt19937 &random, int length, const char *alphabet)
+{
+    std::string text;
+    int size = static_cast<int>(strlen(alphabet));
+    for (int i = 0; i < length; i++)
+        text.push_back(alphabet[std::uniform_int_distribution<int>(0, size - 1)(random)]);
+    return text;
+}
+
+// distances(input) 가 모든 단어에 대해 DP 와 같은지
+static bool matchesAll(FuzzyMatcher &matcher, const std::vector<std::string> &words, const std::string &input)
+{
+    const int *distances = matcher.distances(input);
+    for (size_t w = 0; w < words.size(); w++)
+    {
+        if (distances[w] != levenshtein(words[w], input))
+        {
+            std::cout << "  \"" << words[w] << "\" vs \"" << input << "\": " << distances[w] << " != "
+                      << levenshtein(words[w], input) << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+    std::mt19937 random(2024);
+    const char *letters = "abcdeABCDE"; // 작은 글자 집합이라 거리가 0 부터 길이까지 고르게 나옴
+    std::cout << "=== Fuzzy Match Test ===" << std::endl;
+
+    // distance(): 단어 하나씩
+    {
+        bool singleOk = true;
+        for (int round = 0; round < 200 && singleOk; round++)
+        {
+            std::vector<std::string> words;
+            for (int w = 0; w < 8; w++)
+                words.push_back(randomText(random, std::uniform_int_distribution<int>(0, 12)(random), letters));
+            words.push_back(randomText(random, 70, letters)); // 64자 넘는 단어
+            FuzzyMatcher matcher;
+            matcher.setWords(words);
+            for (int trial = 0; trial < 20 && singleOk; trial++)
+            {
+                std::string input = randomText(random, std::uniform_int_distribution<int>(0, 16)(random), "abcdeABCDExyz");
+                for (size_t w = 0; w < words.size() && singleOk; w++)
+                    singleOk = matcher.distance(static_cast<int>(w), input) == levenshtein(words[w], input);
+            }
+        }
+        report("distance() vs DP", singleOk, ok);
+    }
+
+    // distances(): 타자처럼 이어서 진행, 백스페이스, 가운데 고침
+    {
+        std::vector<std::string> words = {"snowman", "Snowflake", "carrot", "scarf", "", "mitten", "sled", "winter"};
+        FuzzyMatcher matcher;
+        matcher.setWords(words);
+        bool typingOk = true;
+        std::string input;
+        for (char c : std::string("snowfalke"))
+        {
+            input.push_back(c);
+            typingOk = typingOk && matchesAll(matcher, words, input);
+        }
+        // 백스페이스 세 번 후 다시 치기
+        for (int i = 0; i < 3; i++)
+        {
+            input.pop_back();
+            typingOk = typingOk && matchesAll(matcher, words, input);
+        }
+        for (char c : std::string("lakes"))
+        {
+            input.push_back(c);
+            typingOk = typingOk && matchesAll(matcher, words, input);
+        }
+        // 같은 길이로 가운데 글자만 바꿈, 모두 지움, 같은 입력 두 번
+        input[2] = 'X';
+        typingOk = typingOk && matchesAll(matcher, words, input) && matchesAll(matcher, words, input);
+        typingOk = typingOk && matchesAll(matcher, words, "") && matchesAll(matcher, words, "c");
+        report("Incremental typing/backspace", typingOk, ok);
+
+        // 임의의 편집 순서 (붙이기가 대부분, 가끔 지우기/고치기)
+        bool randomOk = true;
+        input.clear();
+        for (int edit = 0; edit < 5000 && randomOk; edit++)
+        {
+            int kind = std::uniform_int_distribution<int>(0, 9)(random);
+            if (kind < 7 || input.empty())
+                input += randomText(random, 1, "snowmaflkecrtSNOW");
+            else if (kind < 9)
+                input.pop_back();
+            else
+                input[std::uniform_int_distribution<size_t>(0, input.size() - 1)(random)] = 'z';
+            if (input.size() > 20)
+                input.clear();
+            randomOk = matchesAll(matcher, words, input);
+        }
+        report("Random edits", randomOk, ok);
+    }
+
+    // 64자 넘는 입력 (이어서 진행하지 않고 매번 처음부터), 단어 목록 교체 뒤
+    {
+        std::vector<std::string> words = {randomText(random, 64, letters), randomText(random, 30, letters), "abc"};
+        FuzzyMatcher matcher;
+        matcher.setWords(words);
+        bool longOk = true;
+        std::string input;
+        for (int i = 0; i < 80 && longOk; i++)
+        {
+            input += words[0][static_cast<size_t>(i) % words[0].size()];
+            longOk = matchesAll(matcher, words, input);
+        }
+        for (int i = 0; i < 20 && longOk; i++)
+        {
+            input.pop_back();
+            longOk = matchesAll(matcher, words, input);
+        }
+        std::vector<std::string> next = {"abd", "ABC", "xyz"};
+        matcher.setWords(next);
+        longOk = longOk && matcher.getWordCount() == 3 && matchesAll(matcher, next, "ab") && matchesAll(matcher, next, "abc");
+        report("Long input / new words", longOk, ok);
+    }
+
+    std::cout << "Fuzzy match: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+// 코퍼스 수집 파이프라인(CorpusIngest) 테스트
+// 작은 덤프 파일로 문장 분리(빈 줄, \r\n 빈 줄), 대소문자 무시 중복 제거, 레벨 수 제한을 확인한다.
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o test_ingest test_ingest.cpp CorpusIngest.cpp SnowDict.cpp Dictionary.cpp
+
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <set>
+#include "CorpusIngest.h"
+#include "Dictionary.h"
+
+int main()
+{
+    std::string path = "test_ingest_dump.txt";
+    {
+        std::ofstream out(path, std::ios::binary);
+        // 같은 문장 (대소문자만 다름) -> 하나만 남음
+        out << "The little snowman smiled at every child passing. ";
+        out << "the Little Snowman smiled at every child PASSING.\n";
+        // 마침표 없이 빈 줄로 나뉜 문장 (\n\n 과 \r\n\r\n)
+        out << "Cold wind carried snow across the quiet valley\n\n";
+        out << "We built a snowman beside the frozen pond\r\n\r\n";
+        out << "Warm cocoa waited for us inside the cabin\r\n\r\n";
+        // 단어 수가 맞지 않는 문장, 입력할 수 없는 단어가 있는 문장
+        out << "Too short to use. Numbers like 42 are not typeable in this game.\n";
+    }
+
+    bool ok = true;
+    std::set<std::string> expected = {
+        "The little snowman smiled at every child passing",
+        "Cold wind carried snow across the quiet valley",
+        "We built a snowman beside the frozen pond",
+        "Warm cocoa waited for us inside the cabin",
+    };
+
+    std::cout << "=== Corpus Ingest Test ===" << std::endl;
+    for (int threads = 1; threads <= 4 && ok; threads *= 2)
+    {
+        CorpusIngest::Options options;
+        options.threadCount = threads;
+        options.levelCount = 5; // 게임 레벨 수(3)를 넘으면 3으로 제한
+        CorpusIngest ingest(options);
+        std::string error;
+        ok = ingest.run({path}, error);
+
+        std::set<std::string> found;
+        size_t total = 0;
+        for (const auto &entry : ingest.getLevelSentences())
+        {
+            ok = ok && entry.first >= 1 && entry.first <= Dictionary::LEVEL_COUNT && !entry.second.empty();
+            for (const std::string &sentence : entry.second)
+            {
+                found.insert(sentence);
+                total++;
+            }
+        }
+        const CorpusIngest::Stats &stats = ingest.getStats();
+        ok = ok && found == expected && total == expected.size() && ingest.getLevelSentences().size() == 3 &&
+             stats.candidates == 5 && stats.unique == 4;
+        std::cout << "Threads " << threads << ": " << (ok ? "OK" : "FAILED " + error) << std::endl;
+    }
+
+    remove(path.c_str());
+    std::cout << "Ingest: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// 리더보드 저장소(Leaderboard) 테스트
+// 임시 디렉터리에서 기록 추가, 다시 열기, 상위 k 개 순서, 색인 + tail 병합,
+// 끊긴 기록(torn write) 뒤의 추가, 색인 파일이 빠진 레벨의 복구를 확인한다.
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_leaderboard test_leaderboard.cpp Leaderboard.cpp
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Leaderboard.h"
+
+// 점수만 뽑아 비교
+static std::vector<int> scoresOf(const std::vector<ScoreEntry> &entries)
+{
+    std::vector<int> scores;
+    for (const ScoreEntry &entry : entries)
+    {
+        scores.push_back(entry.score);
+    }
+    return scores;
+}
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+int main()
+{
+    char pattern[] = "/tmp/test_leaderboard.XXXXXX";
+    if (!mkdtemp(pattern))
+    {
+        std::cout << "cannot create temp dir" << std::endl;
+        return 1;
+    }
+    std::string dir = pattern;
+    bool ok = true;
+    std::cout << "=== Leaderboard Test ===" << std::endl;
+
+    // 추가 + 조회 (색인 없이 tail 만)
+    {
+        Leaderboard board(dir);
+        bool appendOk = board.isOpen();
+        for (int score : {300, 1200, 700, 50, 900})
+        {
+            appendOk = appendOk && board.submit(1, score);
+        }
+        appendOk = appendOk && board.submit(2, 400);
+        board.refresh();
+        appendOk = appendOk && scoresOf(board.topK(1, 3)) == std::vector<int>({1200, 900, 700}) &&
+                   board.countOf(1) == 5 && board.countOf(2) == 1 && board.countOf(3) == 0 &&
+                   board.rankOf(1, 1000) == 2 && board.rankOf(1, 900) == 2 && board.rankOf(1, 10) == 6;
+        report("Append", appendOk, ok);
+    }
+
+    // 다시 열기: 같은 기록
+    {
+        Leaderboard board(dir);
+        bool reopenOk = scoresOf(board.topK(1, 10)) == std::vector<int>({1200, 900, 700, 300, 50}) &&
+                        scoresOf(board.topK(2, 10)) == std::vector<int>({400});
+        report("Reopen", reopenOk, ok);
+    }
+
+    // 색인을 만든 뒤 추가한 기록이 색인과 섞여 순서대로 나오는지
+    {
+        Leaderboard board(dir);
+        bool mergeOk = board.compact();
+        board.submit(1, 800);
+        board.submit(1, 5000);
+        board.refresh();
+        mergeOk = mergeOk && scoresOf(board.topK(1, 4)) == std::vector<int>({5000, 1200, 900, 800}) &&
+                  board.countOf(1) == 7 && board.rankOf(1, 850) == 4;
+        report("Index + tail merge", mergeOk, ok);
+    }
+
+    // 쓰다가 끊긴 기록: 다시 열면 32바이트 경계로 맞추고 그 뒤 기록은 정상으로 읽힘
+    {
+        int fd = open((dir + "/scores.log").c_str(), O_WRONLY | O_APPEND);
+        const char torn[13] = "partial-rec";
+        bool tornOk = fd >= 0 && write(fd, torn, sizeof(torn)) == static_cast<ssize_t>(sizeof(torn));
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        Leaderboard board(dir);
+        tornOk = tornOk && board.countOf(1) == 7 && board.submit(1, 999) && board.submit(3, 10);
+        board.refresh();
+        tornOk = tornOk && board.countOf(1) == 8 && scoresOf(board.topK(1, 3)) == std::vector<int>({5000, 1200, 999}) &&
+                 board.countOf(3) == 1;
+        report("Torn write", tornOk, ok);
+    }
+
+    // compact 중 한 레벨의 색인 쓰기가 실패한 경우 (색인 파일 없음): 그 레벨 기록을 잃지 않음
+    {
+        bool missingOk;
+        {
+            Leaderboard board(dir);
+            missingOk = board.compact();
+        }
+        missingOk = missingOk && remove((dir + "/level2.idx").c_str()) == 0;
+        Leaderboard board(dir);
+        board.submit(1, 1);
+        board.refresh();
+        missingOk = missingOk && board.countOf(2) == 1 && scoresOf(board.topK(2, 5)) == std::vector<int>({400}) &&
+                    board.countOf(1) == 9 && board.countOf(3) == 1;
+        report("Missing level index", missingOk, ok);
+    }
+
+    std::string cleanup = "rm -rf '" + dir + "'";
+    if (system(cleanup.c_str()) != 0)
+    {
+        std::cout << "cannot remove " << dir << std::endl;
+    }
+    std::cout << "Leaderboard: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+// 메트릭 레지스트리(Metrics.h) 테스트
+// - 여러 스레드가 샤드에 나눠 더한 카운터/게이지 합계
+// - 시간 히스토그램의 버킷 경계 (경계값은 그 버킷, 넘으면 다음 버킷, 가장 큰 경계를 넘으면 +Inf)
+// - Prometheus text 형식 (HELP/TYPE 은 이름마다 한 번, 누적 버킷, _sum/_count, 라벨)
+// - MetricsExporter 가 Unix 소켓으로 같은 내용을 돌려주는지
+// - entitiesAlive 게이지가 떨어지고 있는 블록/상자만 세는지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o test_metrics test_metrics.cpp Metrics.cpp SentenceManager.cpp Dictionary.cpp SnowDict.cpp -lncurses
+
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Metrics.h"
+#include "GameSession.h"
+#include "GameClock.h"
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+static bool contains(const std::string &text, const std::string &part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+static size_t countOf(const std::string &text, const std::string &part)
+{
+    size_t count = 0;
+    for (size_t at = text.find(part); at != std::string::npos; at = text.find(part, at + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+// 소켓에 요청을 보내고 응답 전체를 읽음
+static std::string scrape(const char *path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    std::string response;
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0)
+    {
+        const char request[] = "GET /metrics HTTP/1.0\r\n\r\n";
+        if (send(fd, request, sizeof(request) - 1, MSG_NOSIGNAL) > 0)
+        {
+            char buffer[4096];
+            ssize_t got;
+            while ((got = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+            {
+                response.append(buffer, static_cast<size_t>(got));
+            }
+        }
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    return response;
+}
+
+int main()
+{
+    bool ok = true;
+    MetricsRegistry &registry = MetricsRegistry::instance();
+    std::cout << "=== Metrics Test ===" << std::endl;
+
+    // 샤드 합계: 스레드 수가 샤드 수보다 많아도 (같은 샤드를 나눠 써도) 합이 맞아야 함
+    MetricsRegistry::Counter &counter = registry.counter("test_events_total", "Events.");
+    MetricsRegistry::Gauge &gauge = registry.gauge("test_level", "Level.", "kind=\"a\"");
+    MetricsRegistry::Gauge &otherGauge = registry.gauge("test_level", "Level.", "kind=\"b\"");
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < MetricsRegistry::SHARDS + 4; t++)
+        {
+            threads.emplace_back([&counter, &gauge, t]()
+                                 {
+                for (int i = 0; i < 10000; i++)
+                {
+                    counter.add();
+                    gauge.add(t % 2 == 0 ? 2 : -1);
+                } });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+    otherGauge.add(-7);
+    report("Sharded counter/gauge", counter.value() == 200000 && gauge.value() == 100000 && otherGauge.value() == -7, ok);
+
+    // 버킷 경계
+    MetricsRegistry::Timing &timing = registry.timing("test_wait_seconds", "Wait.");
+    timing.record(0);
+    timing.record(1000);        // 1us 버킷 (경계 포함)
+    timing.record(1001);        // 2.5us 버킷
+    timing.record(1000000000);  // 1s 버킷
+    timing.record(5000000000u); // +Inf
+    uint64_t buckets[MetricsRegistry::Timing::BOUNDS + 1];
+    uint64_t sumNanos = 0;
+    timing.snapshot(buckets, sumNanos);
+    int bounds = MetricsRegistry::Timing::BOUNDS;
+    uint64_t total = 0;
+    for (int i = 0; i <= bounds; i++)
+    {
+        total += buckets[i];
+    }
+    report("Histogram buckets", buckets[0] == 2 && buckets[1] == 1 && buckets[bounds - 1] == 1 && buckets[bounds] == 1 &&
+                                    total == 5 && sumNanos == 6000002001ull,
+           ok);
+
+    // Prometheus text
+    std::string text = registry.exposition();
+    bool formatOk = countOf(text, "# HELP test_level Level.\n") == 1 && countOf(text, "# TYPE test_level gauge\n") == 1 &&
+                    contains(text, "test_level{kind=\"a\"} 100000\n") && contains(text, "test_level{kind=\"b\"} -7\n") &&
+                    contains(text, "# TYPE test_events_total counter\ntest_events_total 200000\n") &&
+                    contains(text, "# TYPE test_wait_seconds histogram\n") &&
+                    contains(text, "test_wait_seconds_bucket{le=\"1e-06\"} 2\n") &&
+                    contains(text, "test_wait_seconds_bucket{le=\"2.5e-06\"} 3\n") &&
+                    contains(text, "test_wait_seconds_bucket{le=\"0.25\"} 3\n") &&
+                    contains(text, "test_wait_seconds_bucket{le=\"1\"} 4\n") &&
+                    contains(text, "test_wait_seconds_bucket{le=\"+Inf\"} 5\n") &&
+                    contains(text, "test_wait_seconds_sum 6.000002001\n") &&
+                    contains(text, "test_wait_seconds_count 5\n");
+    report("Prometheus text", formatOk, ok);
+
+    // 소켓 내보내기
+    std::string socketPath = "/tmp/test_metrics." + std::to_string(getpid()) + ".sock";
+    MetricsExporter exporter;
+    bool exporterOk = exporter.start(socketPath.c_str()) && exporter.isRunning();
+    std::string response = exporterOk ? scrape(socketPath.c_str()) : "";
+    exporter.stop();
+    exporterOk = exporterOk && response.compare(0, 15, "HTTP/1.0 200 OK") == 0 &&
+                 contains(response, "\r\n\r\n# HELP") && contains(response, "test_events_total 200000\n") &&
+                 !exporter.isRunning() && access(socketPath.c_str(), F_OK) != 0;
+    report("Exporter", exporterOk, ok);
+
+    // entitiesAlive: 입력칸에 들어간(꺼진) 블록은 세지 않음
+    bool entitiesOk;
+    {
+        GameClock::useSimulated(1700000000000LL);
+        GameMetrics &metrics = GameMetrics::get();
+        GameSession session(1);
+        for (int i = 0; i < 200; i++)
+        {
+            session.tick();
+            GameClock::advance(50);
+        }
+        auto &blocks = session.getSentenceManager()->getWordBlocks();
+        entitiesOk = blocks.size() >= 2;
+        if (entitiesOk)
+        {
+            blocks[0].enteredInInput();
+        }
+        session.tick();
+        int64_t active = 0;
+        for (const auto &block : blocks)
+            active += block.getIsActive() ? 1 : 0;
+        for (const auto &box : session.getSentenceManager()->getItemBoxes())
+            active += box.getIsActive() ? 1 : 0;
+        entitiesOk = entitiesOk && metrics.entitiesAlive.value() == active &&
+                     active < static_cast<int64_t>(blocks.size() + session.getSentenceManager()->getItemBoxes().size());
+        GameClock::useReal();
+    }
+    entitiesOk = entitiesOk && GameMetrics::get().entitiesAlive.value() == 0; // 세션이 끝나면 0
+    report("Active entities gauge", entitiesOk, ok);
+
+    std::cout << "Metrics: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
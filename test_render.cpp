@@ -0,0 +1,338 @@
+// 터미널 없이 화면을 그리는 FrameBuffer 테스트
+// 1. FrameBuffer(창 포함)가 ncurses 가 실제로 내보낸 화면(curscr)과 같은지 (/dev/null 로 내보내는 가상 터미널과 셀 단위 비교)
+// 2. 메뉴 화면이 골든 프레임(test_render_initial.golden)과 똑같은지
+// 3. PlayScreen 을 가상 시계로 돌리며 초당 몇 프레임을 그릴 수 있는지, 프레임 사이에 바뀌는 셀 수 측정
+// 4. 눈(Snowfall): 바뀐 칸만 이어 그린 화면이 매번 처음부터 다 그린 화면과 같은지, 눈송이 5000개의 프레임당 비용
+// 5. 입력칸 힌트: 20자 단어를 한 글자 틀리게 치면 힌트가 입력칸 창 끝에서 잘리고 다음 칸 줄로 넘치지 않는지
+// 실패하면 1 을 돌려준다. 화면을 의도적으로 바꿨다면 --update-golden 으로 골든 파일을 다시 만든다.
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_render test_render.cpp SentenceManager.cpp Dictionary.cpp SnowDict.cpp Leaderboard.cpp Metrics.cpp -lncurses -pthread
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "interface.h"
+#include "FrameBuffer.h"
+#include "GameClock.h"
+
+static const char *GOLDEN_PATH = "test_render_initial.golden";
+static const int SCREEN_ROWS = 50;
+static const int SCREEN_COLS = 120;
+
+// 터미널에 내보낸 내용(curscr)과 FrameBuffer 비교 (다른 셀 수)
+static int compareWithCurses(const FrameBuffer &frame)
+{
+    int mismatches = 0;
+    for (int y = 0; y < frame.getHeight(); y++)
+    {
+        for (int x = 0; x < frame.getWidth(); x++)
+        {
+            chtype ch = mvwinch(curscr, y, x);
+            const FrameBuffer::Cell &cell = frame.at(y, x);
+            if (static_cast<char>(ch & A_CHARTEXT) != cell.glyph ||
+                static_cast<uint16_t>(PAIR_NUMBER(ch)) != cell.pair ||
+                static_cast<uint32_t>(ch & A_ATTRIBUTES & ~A_COLOR) != cell.attrs)
+            {
+                if (mismatches == 0)
+                {
+                    std::cout << "  first mismatch at row " << y << " col " << x << ": curses '"
+                              << static_cast<char>(ch & A_CHARTEXT) << "' vs frame '" << cell.glyph << "'" << std::endl;
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+static bool checkBasics()
+{
+    bool ok = true;
+    FrameBuffer frame(3, 10);
+
+    frame.attrOn(COLOR_PAIR(2) | A_BOLD);
+    frame.print(0, 8, "abcd"); // 줄 끝에서 다음 줄로
+    frame.attrOn(COLOR_PAIR(5)); // 색 쌍만 바뀌고 굵게는 유지
+    frame.print(1, 3, "%d", 7);
+    frame.attrOff(COLOR_PAIR(5)); // 색 쌍 해제
+    frame.print(1, 5, "x");
+    frame.attrOff(A_BOLD);
+    frame.print(2, 8, "zzz");   // 마지막 칸 뒤는 버림
+    frame.print(5, 0, "off");   // 화면 밖
+    frame.print(0, -1, "off");
+
+    ok &= frame.rowText(0) == "        ab";
+    ok &= frame.rowText(1) == "cd 7 x    ";
+    ok &= frame.rowText(2) == "        zz";
+    ok &= frame.at(0, 8).pair == 2 && (frame.at(0, 8).attrs & A_BOLD);
+    ok &= frame.at(1, 3).pair == 5 && (frame.at(1, 3).attrs & A_BOLD);
+    ok &= frame.at(1, 5).pair == 0 && (frame.at(1, 5).attrs & A_BOLD);
+    ok &= frame.at(2, 8).pair == 0 && frame.at(2, 8).attrs == 0;
+
+    FrameBuffer copy = frame;
+    ok &= copy.diff(frame) == 0;
+    copy.print(2, 0, "q");
+    std::vector<FrameBuffer::CellChange> changes;
+    ok &= copy.diff(frame, &changes) == 1 && changes.size() == 1 && changes[0].y == 2 && changes[0].x == 0;
+
+    FrameBuffer parsed(1, 1);
+    ok &= FrameBuffer::fromGolden(frame.toGolden(), parsed) && parsed == frame;
+
+    std::cout << "FrameBuffer basics: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    bool updateGolden = argc > 1 && strcmp(argv[1], "--update-golden") == 0;
+    std::cout << "=== Render Test ===" << std::endl;
+
+    bool ok = checkBasics();
+
+    // 빈 점수 기록 폴더 (메뉴의 TOP SCORES 가 항상 같도록)
+    char scoreDir[] = "/tmp/snowman_render_XXXXXX";
+    if (!mkdtemp(scoreDir))
+    {
+        std::cout << "cannot create temp dir" << std::endl;
+        return 1;
+    }
+    setenv("SNOWMAN_SCORE_DIR", scoreDir, 1);
+
+    // 출력은 버리는 가상 터미널
+    FILE *devNull = fopen("/dev/null", "w");
+    SCREEN *screen = devNull ? newterm("xterm", devNull, stdin) : nullptr;
+    if (screen)
+    {
+        resizeterm(SCREEN_ROWS, SCREEN_COLS);
+        if (has_colors())
+            start_color();
+    }
+
+    // 1 + 2. 메뉴 화면
+    {
+        FrameBuffer frame(SCREEN_ROWS, SCREEN_COLS);
+        CursesTarget curses;
+        TeeTarget tee(frame, curses);
+        InitialScreen menu(screen ? static_cast<RenderTarget &>(tee) : frame);
+        menu.UpdateScreen();
+
+        if (screen)
+        {
+            int mismatches = compareWithCurses(frame);
+            std::cout << "Menu vs ncurses: " << (mismatches == 0 ? "OK" : "FAILED") << " (" << mismatches << " cells)" << std::endl;
+            ok &= mismatches == 0;
+        }
+        else
+        {
+            std::cout << "Menu vs ncurses: skipped (no terminfo)" << std::endl;
+        }
+
+        if (updateGolden)
+        {
+            bool written = frame.writeGoldenFile(GOLDEN_PATH);
+            std::cout << "Golden frame written: " << (written ? GOLDEN_PATH : "FAILED") << std::endl;
+            ok &= written;
+        }
+        else
+        {
+            std::string report;
+            bool match = frame.matchesGoldenFile(GOLDEN_PATH, &report);
+            std::cout << "Menu vs golden: " << (match ? "OK" : "FAILED") << std::endl;
+            if (!match)
+                std::cout << "  " << report << std::endl;
+            ok &= match;
+        }
+    }
+
+    // 1 + 3. 게임 화면: 100초 분량을 그리면서 매 프레임 ncurses 와 비교, 그 다음 FrameBuffer 만으로 속도 측정
+    {
+        GameClock::useSimulated(1700000000000LL);
+        const int FRAMES = 2000;
+        const int TICK_MILLIS = 50;
+        static const char KEYS[] = "snow\tman\trandom\n";
+
+        FrameBuffer frame(SCREEN_ROWS, SCREEN_COLS);
+        FrameBuffer previous(SCREEN_ROWS, SCREEN_COLS);
+        CursesTarget curses;
+        TeeTarget tee(frame, curses);
+        int checkedFrames = 0;
+        int mismatchedFrames = 0;
+        {
+            PlayScreen play(1, screen ? static_cast<RenderTarget &>(tee) : frame);
+            for (int i = 0; i < 200 && play.isRunning(); i++)
+            {
+                play.getSession()->handleKey(KEYS[i % (sizeof(KEYS) - 1)]);
+                play.UpdateScreen();
+                if (screen)
+                {
+                    checkedFrames++;
+                    mismatchedFrames += compareWithCurses(frame) != 0;
+                }
+                GameClock::advance(TICK_MILLIS);
+            }
+        }
+        if (screen)
+        {
+            std::cout << "Play frames vs ncurses: " << (mismatchedFrames == 0 ? "OK" : "FAILED") << " ("
+                      << checkedFrames << " frames)" << std::endl;
+            ok &= mismatchedFrames == 0;
+        }
+
+        bool chromeOk = frame.rowText(0).compare(0, 2, "+-") == 0 &&
+                        frame.rowText(1).find("SNOW MAN GAME - Level 1") != std::string::npos &&
+                        frame.rowText(5).find("TIME REMAINING") != std::string::npos;
+        std::cout << "Play frame layout: " << (chromeOk ? "OK" : "FAILED") << std::endl;
+        ok &= chromeOk;
+
+        long long changedCells = 0;
+        int frames = 0;
+        auto start = std::chrono::steady_clock::now();
+        {
+            PlayScreen play(1, frame);
+            for (; frames < FRAMES && play.isRunning(); frames++)
+            {
+                play.UpdateScreen();
+                changedCells += frame.diff(previous);
+                previous = frame;
+                GameClock::advance(TICK_MILLIS);
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        GameClock::useReal();
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "Rendered " << frames << " frames in " << seconds * 1000.0 << " ms ("
+                  << frames / seconds << " frames/s, " << static_cast<double>(changedCells) / frames
+                  << " changed cells/frame)" << std::endl;
+    }
+
+    // 4. 눈: drawChanged() 로만 이어 그린 창 == 같은 상태를 drawAll() 로 새로 그린 창 (덮인 칸 제외)
+    {
+        const int FIELD_ROWS = SCREEN_ROWS - 5;
+        const int FIELD_COLS = 59;
+        const int FLAKES = 5000;
+        const int FRAMES = 1000;
+        FrameBuffer incremental(FIELD_ROWS, FIELD_COLS);
+        FrameBuffer fresh(FIELD_ROWS, FIELD_COLS);
+        Snowfall snow(FIELD_ROWS, FIELD_COLS, FLAKES, 1, 0);
+        Snowfall replay(FIELD_ROWS, FIELD_COLS, FLAKES, 1, 0);
+        snow.drawAll(incremental);
+        snow.cover(10, 5, 8);
+        incremental.print(10, 5, "snowball");
+        bool snowOk = true;
+        long long drawnCells = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 1; i <= FRAMES; i++)
+        {
+            snow.advance(i * Snowfall::FRAME_MILLIS);
+            drawnCells += snow.drawChanged(incremental);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (int i = 1; i <= FRAMES; i++)
+        {
+            replay.advance(i * Snowfall::FRAME_MILLIS);
+        }
+        replay.cover(10, 5, 8);
+        replay.drawAll(fresh);
+        fresh.print(10, 5, "snowball");
+        snowOk = incremental.diff(fresh) == 0 && drawnCells > 0;
+        std::cout << "Snowfall dirty cells: " << (snowOk ? "OK" : "FAILED") << " (" << FLAKES << " flakes, "
+                  << seconds * 1e6 / FRAMES << " us/frame, " << static_cast<double>(drawnCells) / FRAMES
+                  << " cells/frame)" << std::endl;
+        ok &= snowOk;
+    }
+
+    // 5. 입력칸 힌트: 단어 8개가 모두 20자(입력칸 최대 길이)인 코퍼스로 게임을 돌리고, 첫 칸에 한 글자만 틀리게 침
+    {
+        const int WORD_LENGTH = 20; // 입력칸 최대 길이 (InputHandler::MAX_INPUT_LENGTH)
+        std::string dictPath = std::string(scoreDir) + "/long_words.snowdict";
+        std::string sentence;
+        for (int w = 0; w < Dictionary::WORDS_PER_SENTENCE; w++)
+        {
+            sentence += std::string(WORD_LENGTH, static_cast<char>('a' + w)) + " ";
+        }
+        std::map<int, std::vector<std::string>> levelSentences = {{1, {sentence}}};
+        int skipped = 0;
+        std::string error;
+        std::shared_ptr<const Corpus> longWords;
+        if (SnowDict::write(dictPath, levelSentences, Dictionary::WORDS_PER_SENTENCE, skipped, error))
+        {
+            longWords = Corpus::load(dictPath, error);
+        }
+
+        bool hintOk = longWords != nullptr;
+        if (hintOk)
+        {
+            Corpus::publish(longWords);
+            GameClock::useSimulated(1700000000000LL);
+            FrameBuffer frame(SCREEN_ROWS, SCREEN_COLS);
+            CursesTarget curses;
+            TeeTarget tee(frame, curses);
+            PlayScreen play(1, screen ? static_cast<RenderTarget &>(tee) : frame);
+            // 단어가 모두 한 번씩 화면에 나올 때까지 60초 진행 (나온 단어만 힌트로 알려 줌)
+            for (int i = 0; i < 1200 && play.isRunning(); i++)
+            {
+                play.UpdateScreen();
+                GameClock::advance(50);
+            }
+            std::string typed = std::string(WORD_LENGTH - 1, 'a') + "z";
+            for (char key : typed)
+            {
+                play.getSession()->handleKey(key);
+            }
+            play.UpdateScreen();
+
+            // 첫 칸 줄: 입력, 커서, 힌트가 창 오른쪽 끝(화면 테두리 바로 앞)까지, 다음 칸 줄에는 힌트 글자가 없음
+            int slotRow = -1;
+            size_t slotX = std::string::npos;
+            for (int y = 0; y < SCREEN_ROWS && slotRow < 0; y++)
+            {
+                slotX = frame.rowText(y).find("[1] > ");
+                slotRow = slotX != std::string::npos ? y : -1;
+            }
+            hintOk = play.getSession()->getSentenceManager()->getHintWord() == 0 && slotRow >= 0 &&
+                     slotRow + 1 < SCREEN_ROWS;
+            if (hintOk)
+            {
+                // 입력칸 창의 오른쪽 테두리는 다음 칸 줄에서 찾음 (그 줄은 비어 있으므로 처음 나오는 '|')
+                std::string row = frame.rowText(slotRow);
+                std::string next = frame.rowText(slotRow + 1);
+                size_t border = next.find('|', slotX);
+                std::string shown = "[1] > " + typed + "_ ~ ";
+                hintOk = border != std::string::npos && border > slotX + shown.size() &&
+                         row.compare(slotX, shown.size(), shown) == 0 &&
+                         row.compare(slotX + shown.size(), border - slotX - shown.size(),
+                                     std::string(border - slotX - shown.size(), 'a')) == 0 &&
+                         row[border] == '|' && next.find("[2]") != std::string::npos && next.find('a') == std::string::npos;
+            }
+            if (screen)
+            {
+                hintOk = hintOk && compareWithCurses(frame) == 0;
+            }
+            GameClock::useReal();
+        }
+        Corpus::publish(Corpus::createBuiltin());
+        unlink(dictPath.c_str());
+        std::cout << "Long word hint clipped: " << (hintOk ? "OK" : "FAILED") << std::endl;
+        ok &= hintOk;
+    }
+
+    if (screen)
+    {
+        endwin();
+        delscreen(screen);
+    }
+    if (devNull)
+        fclose(devNull);
+    // 점수를 기록하지 않으므로 빈 로그 파일만 있음
+    unlink((std::string(scoreDir) + "/scores.log").c_str());
+    rmdir(scoreDir);
+
+    std::cout << "Render test: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+// 세션 기록(SessionRecorder) 테스트
+// FrameBuffer 프레임 여러 개를 기록한 뒤 asciicast v2 파일을 읽어서 확인한다.
+// - 머리 줄 (version 2, 화면 크기), 이벤트 줄 형식 [시각, "o"/"m", "JSON 문자열"], 시각이 줄지 않는지
+// - 첫 프레임은 키프레임이고 바로 앞에 "m" (keyframe) 표시가 있는지
+// - 큐를 여러 바퀴 돌 만큼 기록해도 (단일 생산자/단일 소비자 큐) 출력을 다시 그리면 마지막 화면과 같은지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o test_session_recorder test_session_recorder.cpp -lncurses
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "SessionRecorder.h"
+
+static const int SCREEN_ROWS = 30;
+static const int SCREEN_COLS = 100;
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+struct CastEvent
+{
+    double time;
+    std::string type;
+    std::string data; // JSON 문자열을 풀어 낸 출력 바이트
+};
+
+// [시각, "종류", "문자열"] 한 줄 (형식이 틀리면 false)
+static bool parseEvent(const std::string &line, CastEvent &event)
+{
+    size_t comma = line.find(", \"");
+    if (line.size() < 2 || line[0] != '[' || line.compare(line.size() - 2, 2, "\"]") != 0 || comma == std::string::npos)
+        return false;
+    char *end = nullptr;
+    event.time = strtod(line.c_str() + 1, &end);
+    if (end != line.c_str() + comma)
+        return false;
+    size_t typeEnd = line.find('"', comma + 3);
+    if (typeEnd == std::string::npos || line.compare(typeEnd, 4, "\", \"") != 0)
+        return false;
+    event.type = line.substr(comma + 3, typeEnd - comma - 3);
+
+    event.data.clear();
+    for (size_t i = typeEnd + 4; i < line.size() - 2; i++)
+    {
+        char c = line[i];
+        if (c == '"' || static_cast<unsigned char>(c) < 32)
+            return false; // 풀지 않은 따옴표/제어 문자
+        if (c != '\\')
+        {
+            event.data.push_back(c);
+            continue;
+        }
+        if (++i >= line.size() - 2)
+            return false;
+        if (line[i] == '"' || line[i] == '\\')
+            event.data.push_back(line[i]);
+        else if (line[i] == 'u' && i + 4 < line.size() - 2 && line.compare(i + 1, 2, "00") == 0)
+        {
+            event.data.push_back(static_cast<char>(std::stoi(line.substr(i + 3, 2), nullptr, 16)));
+            i += 4;
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
+// 기록에 나오는 만큼만 흉내 내는 터미널 (커서 이동, 화면 지우기, 굵게)
+class ReplayScreen
+{
+private:
+    std::vector<std::string> glyphs;
+    std::vector<std::vector<bool>> bold;
+    int y = 0;
+    int x = 0;
+    bool currentBold = false;
+
+public:
+    ReplayScreen() : glyphs(SCREEN_ROWS, std::string(SCREEN_COLS, ' ')),
+                     bold(SCREEN_ROWS, std::vector<bool>(SCREEN_COLS, false)) {}
+
+    // 모르는 제어 순서가 나오면 false
+    bool feed(const std::string &data)
+    {
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            if (data[i] != '\033')
+            {
+                if (y >= SCREEN_ROWS || x >= SCREEN_COLS)
+                    return false;
+                glyphs[y][x] = data[i];
+                bold[y][x] = currentBold;
+                x++;
+                continue;
+            }
+            if (i + 1 >= data.size() || data[i + 1] != '[')
+                return false;
+            size_t end = i + 2;
+            while (end < data.size() && !isalpha(static_cast<unsigned char>(data[end])))
+                end++;
+            if (end >= data.size())
+                return false;
+            std::string params = data.substr(i + 2, end - i - 2);
+            switch (data[end])
+            {
+            case 'H':
+                if (sscanf(params.c_str(), "%d;%d", &y, &x) != 2)
+                    return false;
+                y--;
+                x--;
+                break;
+            case 'J':
+                if (params != "2")
+                    return false;
+                for (int row = 0; row < SCREEN_ROWS; row++)
+                {
+                    glyphs[row].assign(SCREEN_COLS, ' ');
+                    bold[row].assign(SCREEN_COLS, false);
+                }
+                break;
+            case 'm':
+                // "0;1;3x;4x" 처럼 항상 0 으로 시작
+                if (params.compare(0, 1, "0") != 0)
+                    return false;
+                currentBold = (params + ";").find(";1;") != std::string::npos;
+                break;
+            case 'l':
+                if (params != "?25")
+                    return false;
+                break;
+            default:
+                return false;
+            }
+            i = end;
+        }
+        return true;
+    }
+
+    bool matches(const FrameBuffer &frame) const
+    {
+        for (int row = 0; row < SCREEN_ROWS; row++)
+        {
+            for (int col = 0; col < SCREEN_COLS; col++)
+            {
+                const FrameBuffer::Cell &cell = frame.at(row, col);
+                if (glyphs[row][col] != cell.glyph || bold[row][col] != ((cell.attrs & A_BOLD) != 0))
+                    return false;
+            }
+        }
+        return true;
+    }
+};
+
+int main()
+{
+    bool ok = true;
+    std::string path = "/tmp/test_session_recorder." + std::to_string(getpid()) + ".cast";
+    std::cout << "=== Session Recorder Test ===" << std::endl;
+
+    FrameBuffer frame(SCREEN_ROWS, SCREEN_COLS);
+    uint64_t changedFrames = 0;
+    SessionRecorder recorder;
+    bool startOk = recorder.start(path.c_str(), SCREEN_ROWS, SCREEN_COLS) && recorder.isRecording();
+    report("Start", startOk, ok);
+    if (!startOk)
+    {
+        std::cout << "Session recorder: FAILED" << std::endl;
+        return 1;
+    }
+
+    // 첫 프레임 (키프레임), JSON 에서 풀어 써야 하는 글자 포함
+    frame.print(0, 0, "quote \" backslash \\ done");
+    frame.attrOn(A_BOLD);
+    frame.print(1, 3, "bold");
+    frame.attrOff(A_BOLD);
+    recorder.record(frame);
+    changedFrames++;
+    recorder.record(frame); // 바뀐 것이 없으면 기록하지 않음
+
+    // 화면 전체가 바뀌는 프레임을 큐 크기의 몇 배만큼 (기록 스레드가 밀리면 일부는 버려질 수 있음)
+    size_t perFrame = static_cast<size_t>(SCREEN_ROWS) * (SCREEN_COLS + 8);
+    int bulkFrames = static_cast<int>(3 * SessionRecorder::QUEUE_BYTES / perFrame);
+    for (int step = 0; step < bulkFrames; step++)
+    {
+        if (step % 2 == 1)
+            frame.attrOn(A_BOLD);
+        for (int y = 2; y < SCREEN_ROWS; y++)
+        {
+            frame.print(y, 0, "%06d %0*d", step, SCREEN_COLS - 8, y * 131 + step);
+        }
+        frame.attrOff(A_BOLD);
+        recorder.record(frame);
+        changedFrames++;
+        if (step % 64 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1)); // 기록 스레드가 돌 틈
+    }
+    // 마지막 화면은 기록 스레드가 큐를 다 비운 뒤에 기록해서 버려지지 않게 (파일에 쓴 양이 더 늘지 않을 때까지)
+    for (uint64_t written = 0, i = 0; i < 100; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (recorder.getBytesWritten() == written)
+            break;
+        written = recorder.getBytesWritten();
+    }
+    frame.print(0, 0, "final frame");
+    recorder.record(frame);
+    changedFrames++;
+    uint64_t recordedFrames = recorder.getFrames();
+    bool countOk = recordedFrames + recorder.getDroppedFrames() == changedFrames && recordedFrames > 1;
+    recorder.stop();
+    report("Frame counts", countOk && !recorder.isRecording(), ok);
+
+    // 파일 읽기
+    std::ifstream in(path);
+    std::string line;
+    bool headerOk = static_cast<bool>(std::getline(in, line)) && line.compare(0, 14, "{\"version\": 2,") == 0 &&
+                    line.find("\"width\": " + std::to_string(SCREEN_COLS) + ",") != std::string::npos &&
+                    line.find("\"height\": " + std::to_string(SCREEN_ROWS) + ",") != std::string::npos &&
+                    line.back() == '}';
+    report("Header", headerOk, ok);
+
+    std::vector<CastEvent> events;
+    bool eventsOk = true;
+    while (eventsOk && std::getline(in, line))
+    {
+        CastEvent event;
+        eventsOk = parseEvent(line, event) && (event.type == "o" || event.type == "m") &&
+                   (events.empty() || event.time >= events.back().time);
+        events.push_back(event);
+    }
+    // "m" 은 키프레임 출력 바로 앞에만, 키프레임 출력은 화면 지우기로 시작
+    uint64_t outputs = 0;
+    for (size_t i = 0; eventsOk && i < events.size(); i++)
+    {
+        bool clears = events[i].data.compare(0, 14, "\033[?25l\033[0m\033[2J") == 0;
+        if (events[i].type == "m")
+            eventsOk = events[i].data == "keyframe" && i + 1 < events.size() && events[i + 1].type == "o" &&
+                       events[i + 1].data.compare(0, 14, "\033[?25l\033[0m\033[2J") == 0;
+        else
+            eventsOk = clears == (i > 0 && events[i - 1].type == "m");
+        outputs += events[i].type == "o";
+    }
+    eventsOk = eventsOk && events.size() >= 2 && events[0].type == "m" && outputs == recordedFrames &&
+               events[1].data.find("quote \" backslash \\ done") != std::string::npos;
+    report("Events and keyframe marker", eventsOk, ok);
+
+    ReplayScreen screen;
+    bool replayOk = eventsOk;
+    for (const CastEvent &event : events)
+    {
+        if (replayOk && event.type == "o")
+            replayOk = screen.feed(event.data);
+    }
+    replayOk = replayOk && screen.matches(frame);
+    report("Replay matches last frame", replayOk, ok);
+
+    remove(path.c_str());
+    std::cout << "Session recorder: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+// 관전 방송(SpectatorFeed) 테스트
+// - publish() 로 올린 프레임을 관전자 소켓에서 받아 apply() 하면 같은 화면이 되는지 (키프레임/델타, 번호)
+// - 관전자가 읽지 않아 링에서 밀려나면 가장 최근 키프레임으로 건너뛰고, 다시 읽으면 마지막 화면까지 따라오는지
+// - 방송 스레드가 링 버퍼에서 바로 보내는 동안 게임 스레드가 계속 올려도, 받은 메시지마다 그 번호의 프레임과 같은지
+//   (보내는 중인 버퍼를 게임 스레드가 다시 쓰면 내용이 섞임, -fsanitize=thread 로도 확인)
+// - 잘못된 메시지는 apply() 가 거부하는지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o test_spectator_feed test_spectator_feed.cpp -lncurses
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SpectatorFeed.h"
+
+static const int SCREEN_ROWS = 50;
+static const int SCREEN_COLS = 120;
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+static int connectViewer(const std::string &path)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+// 메시지 하나 받기 (waitMillis 안에 없으면 0)
+static ssize_t receive(int fd, std::vector<uint8_t> &message, int waitMillis)
+{
+    pollfd waiting = {fd, POLLIN, 0};
+    if (poll(&waiting, 1, waitMillis) <= 0)
+        return 0;
+    return recv(fd, message.data(), message.size(), 0);
+}
+
+static SpectatorHeader headerOf(const std::vector<uint8_t> &message)
+{
+    SpectatorHeader header;
+    memcpy(&header, message.data(), sizeof(header));
+    return header;
+}
+
+// 조금만 바뀌는 프레임 (델타가 작음)
+static void drawSmall(FrameBuffer &frame, int step)
+{
+    frame.attrOff(A_BOLD);
+    frame.print(0, 0, "frame %d", step);
+    frame.attrOn(A_BOLD);
+    frame.print(1 + step % (SCREEN_ROWS - 1), (step * 7) % (SCREEN_COLS - 1), "*");
+    frame.attrOff(A_BOLD);
+}
+
+// 모든 줄이 바뀌는 프레임 (델타가 키프레임만큼 큼)
+static void drawFull(FrameBuffer &frame, int step)
+{
+    for (int y = 0; y < SCREEN_ROWS; y++)
+    {
+        frame.print(y, 0, "%03d %0*d", step, SCREEN_COLS - 5, y * 7919 + step);
+    }
+}
+
+int main()
+{
+    bool ok = true;
+    std::string path = "/tmp/test_spectator_feed." + std::to_string(getpid()) + ".sock";
+    std::cout << "=== Spectator Feed Test ===" << std::endl;
+
+    SpectatorFeed feed;
+    bool startOk = feed.start(path.c_str(), SCREEN_ROWS, SCREEN_COLS) && feed.isRunning();
+    int fd = startOk ? connectViewer(path) : -1;
+    for (int i = 0; i < 200 && fd >= 0 && feed.getViewerCount() == 0; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    startOk = startOk && fd >= 0 && feed.getViewerCount() == 1;
+    report("Start", startOk, ok);
+    if (!startOk)
+    {
+        std::cout << "Spectator feed: FAILED" << std::endl;
+        return 1;
+    }
+
+    FrameBuffer published(SCREEN_ROWS, SCREEN_COLS);
+    FrameBuffer viewed(SCREEN_ROWS, SCREEN_COLS);
+    std::vector<uint8_t> message(SpectatorFeed::maxMessageSize(SCREEN_ROWS, SCREEN_COLS));
+
+    // 한 프레임씩 올리고 바로 받기: 번호가 이어지고 KEYFRAME_INTERVAL 마다 키프레임
+    {
+        bool roundTripOk = true;
+        for (int step = 0; step < 3 * SpectatorFeed::KEYFRAME_INTERVAL + 5 && roundTripOk; step++)
+        {
+            drawSmall(published, step);
+            feed.publish(published);
+            ssize_t length = receive(fd, message, 2000);
+            SpectatorHeader header = length > 0 ? headerOf(message) : SpectatorHeader();
+            bool expectKeyframe = step % SpectatorFeed::KEYFRAME_INTERVAL == 0;
+            size_t smallDelta = SpectatorFeed::maxMessageSize(SCREEN_ROWS, SCREEN_COLS) / 4;
+            roundTripOk = length > 0 && header.seq == static_cast<uint32_t>(step) &&
+                          header.type == (expectKeyframe ? SpectatorFeed::KEYFRAME : SpectatorFeed::DELTA) &&
+                          (expectKeyframe || static_cast<size_t>(length) < smallDelta) &&
+                          SpectatorFeed::apply(message.data(), static_cast<size_t>(length), viewed) &&
+                          viewed.diff(published) == 0;
+        }
+        // 바뀐 칸이 없으면 메시지를 만들지 않음
+        uint64_t before = feed.getPublished();
+        feed.publish(published);
+        roundTripOk = roundTripOk && feed.getPublished() == before && receive(fd, message, 100) == 0;
+        report("Keyframe/delta round trip", roundTripOk, ok);
+    }
+
+    // 관전자가 읽지 않는 동안 링이 한 바퀴 넘게 돎 -> 밀려난 뒤 첫 메시지는 키프레임
+    // drawFull 은 모든 줄을 덮으므로 메시지 seq 를 적용한 화면은 drawFull(seq - firstSeq) 와 같아야 함
+    {
+        uint32_t lastSeq = static_cast<uint32_t>(feed.getPublished() - 1);
+        uint32_t firstSeq = lastSeq + 1;
+        for (int step = 0; step < 3 * SpectatorFeed::RING_SLOTS; step++)
+        {
+            drawFull(published, step);
+            feed.publish(published);
+            std::this_thread::sleep_for(std::chrono::microseconds(200)); // 방송 스레드가 돌 틈
+        }
+        int gaps = 0;
+        int skippedToDelta = 0;
+        int received = 0;
+        int mismatched = 0;
+        FrameBuffer expected(SCREEN_ROWS, SCREEN_COLS);
+        ssize_t length;
+        while ((length = receive(fd, message, 500)) > 0)
+        {
+            SpectatorHeader header = headerOf(message);
+            if (header.seq != lastSeq + 1)
+            {
+                gaps++;
+                skippedToDelta += header.type != SpectatorFeed::KEYFRAME;
+            }
+            lastSeq = header.seq;
+            received++;
+            drawFull(expected, static_cast<int>(header.seq - firstSeq));
+            mismatched += !SpectatorFeed::apply(message.data(), static_cast<size_t>(length), viewed) ||
+                          viewed.diff(expected) != 0;
+        }
+        bool skipOk = gaps > 0 && skippedToDelta == 0 && mismatched == 0 && feed.getViewerSkips() > 0 &&
+                      received < 3 * SpectatorFeed::RING_SLOTS && lastSeq == feed.getPublished() - 1 &&
+                      viewed.diff(published) == 0;
+        report("Skip to keyframe", skipOk, ok);
+    }
+
+    // 관전자가 계속 읽는 동안 쉬지 않고 올림: 방송 스레드가 보내는 중인 버퍼가 링에서 밀려나는 경우가 생김
+    {
+        uint32_t firstSeq = static_cast<uint32_t>(feed.getPublished());
+        const int frames = 20 * SpectatorFeed::RING_SLOTS;
+        std::atomic<bool> done(false);
+        int mismatched = 0;
+        int received = 0;
+        std::thread reader([&]()
+                           {
+            std::vector<uint8_t> incoming(message.size());
+            FrameBuffer shown(SCREEN_ROWS, SCREEN_COLS);
+            FrameBuffer expected(SCREEN_ROWS, SCREEN_COLS);
+            shown = viewed;
+            ssize_t length;
+            while ((length = receive(fd, incoming, done ? 500 : 2000)) > 0)
+            {
+                SpectatorHeader header = headerOf(incoming);
+                drawFull(expected, static_cast<int>(header.seq - firstSeq));
+                mismatched += !SpectatorFeed::apply(incoming.data(), static_cast<size_t>(length), shown) ||
+                              shown.diff(expected) != 0;
+                received++;
+                if (header.seq == firstSeq + frames - 1)
+                    break;
+            }
+            viewed = shown; });
+        for (int step = 0; step < frames; step++)
+        {
+            drawFull(published, step);
+            feed.publish(published);
+        }
+        done = true;
+        reader.join();
+        bool concurrentOk = received > 0 && mismatched == 0 && viewed.diff(published) == 0;
+        report("Send from ring while publishing", concurrentOk, ok);
+    }
+
+    // 잘못된 메시지: 잘린 메시지, 다른 크기의 화면, 화면 밖 구간
+    {
+        drawSmall(published, 1000);
+        feed.publish(published);
+        ssize_t length = receive(fd, message, 2000);
+        FrameBuffer other(SCREEN_ROWS - 1, SCREEN_COLS);
+        bool rejectOk = length > static_cast<ssize_t>(sizeof(SpectatorHeader) + sizeof(SpectatorRun)) &&
+                        !SpectatorFeed::apply(message.data(), static_cast<size_t>(length) - 1, viewed) &&
+                        !SpectatorFeed::apply(message.data(), sizeof(SpectatorHeader) - 1, viewed) &&
+                        !SpectatorFeed::apply(message.data(), static_cast<size_t>(length), other);
+        if (rejectOk)
+        {
+            SpectatorRun run;
+            memcpy(&run, message.data() + sizeof(SpectatorHeader), sizeof(run));
+            run.x = static_cast<uint16_t>(SCREEN_COLS - run.length + 1);
+            memcpy(message.data() + sizeof(SpectatorHeader), &run, sizeof(run));
+            rejectOk = !SpectatorFeed::apply(message.data(), static_cast<size_t>(length), viewed);
+        }
+        report("Corrupt messages rejected", rejectOk, ok);
+    }
+
+    close(fd);
+    feed.stop();
+    bool stopOk = !feed.isRunning() && access(path.c_str(), F_OK) != 0;
+    report("Stop", stopOk, ok);
+
+    std::cout << "Spectator feed: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
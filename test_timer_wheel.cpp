@@ -0,0 +1,141 @@
+// 계층형 타이머 휠(TimerWheel) 테스트
+// - 한 번/주기 타이머가 정확한 시각에 실행되는지, 윗단에서 내려오는(cascade) 먼 타이머
+// - 같은 칸에서 실행 중인 콜백이 그 칸의 다른 타이머를 restart/cancel 해도 리스트가 깨지지 않는지
+// - nextDeadline() 이 가장 이른 만료 시각을 알려 주는지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_timer_wheel test_timer_wheel.cpp
+
+#include <iostream>
+#include <vector>
+#include "TimerWheel.h"
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+// 화면 루프처럼 step ms 씩 진행 (한 번에 크게 넘기면 밀린 주기는 건너뜀)
+static int advanceInSteps(TimerWheel &wheel, int64_t until, int64_t step)
+{
+    int fired = 0;
+    for (int64_t t = wheel.getNow() + step; t < until; t += step)
+    {
+        fired += wheel.advance(t);
+    }
+    return fired + wheel.advance(until);
+}
+
+int main()
+{
+    bool ok = true;
+    const int64_t start = 1700000000123LL; // 0단 창 경계에 맞지 않는 시작 시각
+    std::cout << "=== Timer Wheel Test ===" << std::endl;
+
+    // 한 번 / 주기 타이머
+    {
+        TimerWheel wheel(start);
+        std::vector<int64_t> onceAt, periodicAt;
+        wheel.schedule(10, [&]()
+                       { onceAt.push_back(wheel.getNow()); });
+        wheel.schedulePeriodic(100, [&]()
+                               { periodicAt.push_back(wheel.getNow()); });
+        int fired = advanceInSteps(wheel, start + 350, 16);
+        bool basicOk = fired == 4 && onceAt == std::vector<int64_t>({start + 10}) &&
+                       periodicAt == std::vector<int64_t>({start + 100, start + 200, start + 300}) &&
+                       wheel.getActiveCount() == 1 && wheel.nextDeadline() == start + 400;
+        // 한 번에 크게 넘기면 밀린 주기(400, 500)는 한 번만 실행하고 다음 주기로
+        fired = wheel.advance(start + 590);
+        basicOk = basicOk && fired == 1 && periodicAt.back() == start + 400 && wheel.nextDeadline() == start + 690;
+        report("Once/periodic", basicOk, ok);
+    }
+
+    // 윗단 타이머: 여러 단을 거쳐 내려와 제 시각에 실행
+    {
+        TimerWheel wheel(start);
+        std::vector<int64_t> delays = {300, 5000, 20000, 70000, 3600000};
+        std::vector<int64_t> firedAt;
+        for (int64_t delay : delays)
+        {
+            wheel.schedule(delay, [&]()
+                           { firedAt.push_back(wheel.getNow()); });
+        }
+        bool cascadeOk = wheel.nextDeadline() == start + 300;
+        advanceInSteps(wheel, start + 3600000, 997);
+        cascadeOk = cascadeOk && firedAt.size() == delays.size();
+        for (size_t i = 0; cascadeOk && i < delays.size(); i++)
+        {
+            // advance 한 번에 여러 ms 를 건너도 실행 시각(getNow)은 만료 시각 그대로
+            cascadeOk = firedAt[i] == start + delays[i];
+        }
+        cascadeOk = cascadeOk && wheel.getActiveCount() == 0 && wheel.nextDeadline() == INT64_MAX;
+        report("Cascade", cascadeOk, ok);
+    }
+
+    // nextDeadline: 윗단에만 있는 타이머, 0단 창을 넘어간 칸
+    {
+        TimerWheel wheel(start);
+        TimerWheel::TimerId far = wheel.schedule(40000, []() {});
+        bool deadlineOk = wheel.nextDeadline() == start + 40000;
+        wheel.schedule(1000, []() {});
+        deadlineOk = deadlineOk && wheel.nextDeadline() == start + 1000;
+        wheel.advance(start + 1000);
+        deadlineOk = deadlineOk && wheel.nextDeadline() == start + 40000;
+        wheel.schedule(200, []() {}); // 현재 칸보다 앞 번호의 칸 (다음 창)
+        deadlineOk = deadlineOk && wheel.nextDeadline() == start + 1200 && wheel.cancel(far) &&
+                     !wheel.cancel(far) && wheel.nextDeadline() == start + 1200;
+        report("Next deadline", deadlineOk, ok);
+    }
+
+    // 같은 칸의 다른 타이머를 콜백 안에서 restart / cancel
+    // (GameSession 이 라운드를 끝낼 때 단어 생성 타이머를 restart 하는 경우)
+    {
+        TimerWheel wheel(start);
+        int firstRuns = 0, restartedRuns = 0, cancelledRuns = 0, selfRuns = 0;
+        TimerWheel::TimerId restarted = TimerWheel::NO_TIMER, cancelled = TimerWheel::NO_TIMER;
+        TimerWheel::TimerId self = TimerWheel::NO_TIMER;
+        std::vector<int64_t> restartedAt;
+        // 같은 시각 -> 같은 칸, 나중에 넣은 것이 먼저 실행됨
+        restarted = wheel.schedulePeriodic(100, [&]()
+                                           {
+                                               restartedRuns++;
+                                               restartedAt.push_back(wheel.getNow()); });
+        cancelled = wheel.schedule(100, [&]()
+                                   { cancelledRuns++; });
+        self = wheel.schedule(100, [&]()
+                              {
+                                  selfRuns++;
+                                  if (selfRuns == 1)
+                                      wheel.restart(self, 30); // 한 번 타이머가 자기 자신을 다시 시작
+                              });
+        wheel.schedule(100, [&]()
+                       {
+                           firstRuns++;
+                           wheel.restart(restarted, 50);
+                           wheel.cancel(cancelled);
+                           wheel.schedule(1, []() {}); // 실행 중에 새 노드 추가
+                       });
+        bool inFlightOk = wheel.isPending(restarted) && wheel.isPending(cancelled);
+        int fired = wheel.advance(start + 100);
+        inFlightOk = inFlightOk && fired == 2 && firstRuns == 1 && selfRuns == 1 && restartedRuns == 0 &&
+                     cancelledRuns == 0 && !wheel.isPending(cancelled) && wheel.isPending(restarted) &&
+                     wheel.isPending(self) && wheel.nextDeadline() == start + 101;
+        advanceInSteps(wheel, start + 400, 16);
+        inFlightOk = inFlightOk && selfRuns == 2 && cancelledRuns == 0 && !wheel.isPending(self) &&
+                     restartedAt == std::vector<int64_t>({start + 150, start + 250, start + 350}) &&
+                     wheel.getActiveCount() == 1;
+
+        // 주기 타이머가 실행되는 칸에서 앞 콜백이 그 타이머를 취소
+        TimerWheel::TimerId victim = wheel.schedulePeriodic(10, [&]()
+                                                            { cancelledRuns++; });
+        wheel.schedule(10, [&]()
+                       { wheel.cancel(victim); });
+        advanceInSteps(wheel, start + 500, 16);
+        inFlightOk = inFlightOk && cancelledRuns == 0 && !wheel.isPending(victim) && wheel.getActiveCount() == 1;
+        report("Restart/cancel in same slot", inFlightOk, ok);
+    }
+
+    std::cout << "Timer wheel: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+// 타자 분석 로그(TypingAnalytics::writeLog / readLog) 테스트
+// - 키 이벤트를 넣고 쓴 로그를 다시 읽으면 머리, 이벤트 열(시간/코드/칸+플래그), 단어 지연, 글자별 오류가 같은지
+// - 열 정보나 열 데이터가 깨진 파일은 거부하고, 모르는 열은 건너뛰는지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o test_typing_analytics test_typing_analytics.cpp
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "TypingAnalytics.h"
+
+static void report(const char *name, bool ok, bool &allOk)
+{
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    allOk = allOk && ok;
+}
+
+static std::vector<uint8_t> readBytes(const std::string &path)
+{
+    std::vector<uint8_t> bytes;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+        return bytes;
+    int c;
+    while ((c = fgetc(file)) != EOF)
+        bytes.push_back(static_cast<uint8_t>(c));
+    fclose(file);
+    return bytes;
+}
+
+static void writeBytes(const std::string &path, const std::vector<uint8_t> &bytes)
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+        return;
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+}
+
+// 파일 안에서 id 열의 ColumnInfo 위치 (없으면 0)
+static size_t columnInfoAt(const std::vector<uint8_t> &bytes, uint32_t id)
+{
+    TypingAnalytics::LogHeader header;
+    memcpy(&header, bytes.data(), sizeof(header));
+    for (uint32_t i = 0; i < header.columnCount; i++)
+    {
+        size_t at = sizeof(header) + i * sizeof(TypingAnalytics::ColumnInfo);
+        TypingAnalytics::ColumnInfo info;
+        memcpy(&info, bytes.data() + at, sizeof(info));
+        if (info.id == id)
+            return at;
+    }
+    return 0;
+}
+
+static TypingAnalytics::ColumnInfo columnInfo(const std::vector<uint8_t> &bytes, uint32_t id)
+{
+    TypingAnalytics::ColumnInfo info;
+    memcpy(&info, bytes.data() + columnInfoAt(bytes, id), sizeof(info));
+    return info;
+}
+
+static void setColumnInfo(std::vector<uint8_t> &bytes, uint32_t id, const TypingAnalytics::ColumnInfo &info)
+{
+    memcpy(bytes.data() + columnInfoAt(bytes, id), &info, sizeof(info));
+}
+
+int main()
+{
+    char pattern[] = "/tmp/test_typing_analytics.XXXXXX";
+    if (!mkdtemp(pattern))
+    {
+        std::cout << "cannot create temp dir" << std::endl;
+        return 1;
+    }
+    std::string dir = pattern;
+    bool ok = true;
+    std::cout << "=== Typing Analytics Log Test ===" << std::endl;
+
+    // 세션 하나: 칸 0 에 "cat" (한 번 틀리고 고침), 칸 1 을 틀리게 제출, 칸 0 을 다시 제출 (이미 맞힘)
+    const int64_t start = 1700000000000LL;
+    TypingAnalytics analytics(start, true);
+    analytics.beginRound();
+    analytics.onCharacter(start + 100, 0, 'c', 'c', true);
+    analytics.onCharacter(start + 300, 0, 'x', 'a', true);
+    analytics.onBackspace(start + 20300, 0); // 2바이트 넘는 시간 차 (varint)
+    analytics.onCharacter(start + 20400, 0, 'a', 'a', true);
+    analytics.onCharacter(start + 20500, 0, 'T', 't', true);
+    analytics.onCharacter(start + 20600, 0, '!', 0, false); // 칸이 가득 참
+    analytics.onSubmit(start + 20700, 0, true, start + 50);
+    analytics.onNavigate(start + 20800, 1, true);
+    analytics.onCharacter(start + 20900, 1, '9', 'd', true);
+    analytics.onSubmit(start + 21000, 1, false, start + 2000);
+    analytics.onNavigate(start + 21100, 0, false);
+    analytics.onSubmit(start + 21200, 0, true, start + 50);
+    analytics.onCharacter(start + 21300, 2, 'q', 'p', true);
+    analytics.onCharacter(start + 21350, 2, 'q', 'p', true);
+
+    const std::vector<uint32_t> expectedMillis = {100, 300, 20300, 20400, 20500, 20600, 20700,
+                                                  20800, 20900, 21000, 21100, 21200, 21300, 21350};
+    const std::vector<uint8_t> expectedCodes = {'c', 'x', TypingAnalytics::CODE_BACKSPACE, 'a', 'T', '!',
+                                                TypingAnalytics::CODE_SUBMIT, TypingAnalytics::CODE_NEXT, '9',
+                                                TypingAnalytics::CODE_SUBMIT, TypingAnalytics::CODE_PREVIOUS,
+                                                TypingAnalytics::CODE_SUBMIT, 'q', 'q'};
+    const uint8_t HIT = TypingAnalytics::FLAG_HIT << 4;
+    const uint8_t MISS = TypingAnalytics::FLAG_MISS << 4;
+    const uint8_t CREDITED = TypingAnalytics::FLAG_CREDITED << 4;
+    const uint8_t UNCOUNTED = TypingAnalytics::FLAG_UNCOUNTED << 4;
+    const std::vector<uint8_t> expectedSlotFlags = {HIT, MISS, 0, HIT, HIT, UNCOUNTED, HIT | CREDITED,
+                                                    1, 1 | MISS, 1 | MISS, 0, HIT, 2 | MISS, 2 | MISS};
+
+    // 로그를 끈 분석기는 쓰지 않음
+    TypingAnalytics quiet(start);
+    quiet.onCharacter(start + 10, 0, 'a', 'a', true);
+    report("Logging off", !quiet.writeLog(dir.c_str(), 1, 1) && !quiet.isLogging(), ok);
+
+    std::string path = dir + "/typing-" + std::to_string(getpid()) + "-7.snta";
+    TypingAnalytics::Log log;
+    std::string error;
+    bool roundTripOk = analytics.writeLog(dir.c_str(), 7, 2) && TypingAnalytics::readLog(path.c_str(), log, error);
+    roundTripOk = roundTripOk && log.header.version == 1 && log.header.level == 2 && log.header.sessionId == 7 &&
+                  log.header.pid == static_cast<uint32_t>(getpid()) && log.header.startMillis == start &&
+                  log.header.durationMillis == 21350 && log.eventMillis == expectedMillis &&
+                  log.eventCodes == expectedCodes && log.eventSlotFlags == expectedSlotFlags &&
+                  log.wordSlots == std::vector<uint8_t>({0}) && log.wordLatencyMillis == std::vector<uint32_t>({20650});
+    for (int expected = 0; roundTripOk && expected < TypingAnalytics::LETTERS; expected++)
+    {
+        roundTripOk = log.letterCounts[expected] == analytics.getLetterCount(expected);
+        for (int typed = 0; roundTripOk && typed <= TypingAnalytics::LETTERS; typed++)
+        {
+            roundTripOk = log.letterErrors[expected][typed] == analytics.getLetterErrors(expected, typed);
+        }
+    }
+    roundTripOk = roundTripOk && log.letterErrors['a' - 'a']['x' - 'a'] == 1 &&
+                  log.letterErrors['d' - 'a'][TypingAnalytics::LETTERS] == 1 && log.letterErrors['p' - 'a']['q' - 'a'] == 2 &&
+                  log.letterCounts['t' - 'a'] == 1 && log.letterCounts['p' - 'a'] == 2;
+    report("Round trip", roundTripOk, ok);
+
+    // 깨진 파일: 파일을 고친 뒤 읽어서 error 가 기대한 것과 같은지
+    std::vector<uint8_t> original = readBytes(path);
+    std::string corruptPath = dir + "/corrupt.snta";
+    auto rejects = [&](std::vector<uint8_t> bytes, const std::string &expectedError)
+    {
+        writeBytes(corruptPath, bytes);
+        TypingAnalytics::Log corrupt;
+        std::string corruptError;
+        return !TypingAnalytics::readLog(corruptPath.c_str(), corrupt, corruptError) && corruptError == expectedError;
+    };
+    bool corruptOk = !original.empty();
+    if (corruptOk)
+    {
+        std::vector<uint8_t> bytes = original;
+        bytes[0] = 'X';
+        corruptOk = rejects(bytes, "not a typing log");
+
+        bytes = original;
+        bytes.resize(sizeof(TypingAnalytics::LogHeader) + sizeof(TypingAnalytics::ColumnInfo)); // 열 정보가 잘림
+        corruptOk = corruptOk && rejects(bytes, "not a typing log");
+
+        bytes = original;
+        bytes.pop_back(); // 마지막 열(글자별 횟수)이 파일 밖으로
+        corruptOk = corruptOk && rejects(bytes, "column out of range");
+
+        // 시간 열의 마지막 varint 가 끝나지 않음
+        bytes = original;
+        TypingAnalytics::ColumnInfo info = columnInfo(bytes, TypingAnalytics::COLUMN_TIME);
+        bytes[info.offset + info.size - 1] |= 0x80;
+        corruptOk = corruptOk && rejects(bytes, "corrupt column 1");
+
+        // 코드 열의 크기와 행 수가 다름
+        bytes = original;
+        info = columnInfo(bytes, TypingAnalytics::COLUMN_CODE);
+        info.rows++;
+        setColumnInfo(bytes, TypingAnalytics::COLUMN_CODE, info);
+        corruptOk = corruptOk && rejects(bytes, "corrupt column 2");
+
+        // 글자별 오류의 글자 번호가 범위 밖
+        bytes = original;
+        info = columnInfo(bytes, TypingAnalytics::COLUMN_LETTER_ERRORS);
+        bytes[info.offset] = TypingAnalytics::LETTERS;
+        corruptOk = corruptOk && rejects(bytes, "corrupt column 6");
+
+        // 글자별 오류의 행 수가 데이터보다 많음
+        bytes = original;
+        info = columnInfo(bytes, TypingAnalytics::COLUMN_LETTER_ERRORS);
+        info.rows++;
+        setColumnInfo(bytes, TypingAnalytics::COLUMN_LETTER_ERRORS, info);
+        corruptOk = corruptOk && rejects(bytes, "corrupt column 6");
+
+        // 열마다는 맞지만 이벤트 열끼리 길이가 다름
+        bytes = original;
+        info = columnInfo(bytes, TypingAnalytics::COLUMN_SLOT_FLAGS);
+        info.rows--;
+        info.size--;
+        setColumnInfo(bytes, TypingAnalytics::COLUMN_SLOT_FLAGS, info);
+        corruptOk = corruptOk && rejects(bytes, "column lengths differ");
+
+        // 모르는 열은 건너뜀 (나중 버전 호환)
+        bytes = original;
+        info = columnInfo(bytes, TypingAnalytics::COLUMN_LETTER_COUNTS);
+        info.id = 99;
+        setColumnInfo(bytes, TypingAnalytics::COLUMN_LETTER_COUNTS, info);
+        writeBytes(corruptPath, bytes);
+        TypingAnalytics::Log unknown;
+        corruptOk = corruptOk && TypingAnalytics::readLog(corruptPath.c_str(), unknown, error) &&
+                    unknown.eventCodes == expectedCodes && unknown.letterCounts['p' - 'a'] == 0;
+    }
+    report("Corrupt logs rejected", corruptOk, ok);
+
+    std::string cleanup = "rm -rf '" + dir + "'";
+    if (system(cleanup.c_str()) != 0)
+    {
+        std::cout << "cannot remove " << dir << std::endl;
+    }
+    std::cout << "Typing analytics log: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+// WorkStealingPool 테스트
+// - 밖에서 넣은 작업과 워커 안에서 넣은 작업(자기 덱)이 모두 정확히 한 번씩 실행되는지
+// - wait() 뒤에 다시 넣어도 되는지, 다른 풀의 워커가 넣은 작업도 실행되는지
+// - wait() 없이 소멸해도 남은 작업을 다 끝내고 스레드가 정리되는지
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -pthread -o test_work_stealing test_work_stealing.cpp
+
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "WorkStealingPool.h"
+
+static const int OUTER_TASKS = 200;
+static const int INNER_TASKS = 20;
+
+// 모든 칸이 정확히 1인지
+static bool allOnce(const std::vector<std::atomic<int>> &runs)
+{
+    for (const auto &run : runs)
+    {
+        if (run.load() != 1)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+    std::cout << "=== Work Stealing Pool Test ===" << std::endl;
+
+    for (int threads = 1; threads <= 4; threads++)
+    {
+        std::vector<std::atomic<int>> runs(OUTER_TASKS * (INNER_TASKS + 1));
+        bool threadOk;
+        {
+            WorkStealingPool pool(threads);
+            threadOk = pool.getThreadCount() == threads;
+            for (int round = 0; round < 2; round++)
+            {
+                // 두 번째 바퀴는 wait() 뒤에 다시 넣기 (칸은 바퀴마다 절반씩)
+                for (int i = round * OUTER_TASKS / 2; i < (round + 1) * OUTER_TASKS / 2; i++)
+                {
+                    pool.submit([&pool, &runs, i]()
+                                {
+                        runs[static_cast<size_t>(i * (INNER_TASKS + 1))]++;
+                        for (int j = 1; j <= INNER_TASKS; j++)
+                        {
+                            pool.submit([&runs, i, j]()
+                                        { runs[static_cast<size_t>(i * (INNER_TASKS + 1) + j)]++; });
+                        } });
+                }
+                pool.wait();
+            }
+            threadOk = threadOk && allOnce(runs);
+        }
+        std::cout << "Threads " << threads << ": " << (threadOk ? "OK" : "FAILED") << std::endl;
+        ok = ok && threadOk;
+    }
+
+    // 다른 풀의 워커 안에서 넣은 작업
+    {
+        std::vector<std::atomic<int>> runs(64);
+        {
+            WorkStealingPool outer(2);
+            WorkStealingPool inner(3);
+            for (int i = 0; i < 64; i++)
+            {
+                outer.submit([&inner, &runs, i]()
+                             { inner.submit([&runs, i]()
+                                            { runs[static_cast<size_t>(i)]++; }); });
+            }
+            outer.wait();
+            inner.wait();
+        }
+        bool nestedOk = allOnce(runs);
+        std::cout << "Nested pools: " << (nestedOk ? "OK" : "FAILED") << std::endl;
+        ok = ok && nestedOk;
+    }
+
+    // wait() 없이 소멸: 남은 작업은 다 실행되고 소멸자가 돌아와야 함
+    {
+        std::vector<std::atomic<int>> runs(1000);
+        {
+            WorkStealingPool pool(3);
+            for (int i = 0; i < 1000; i++)
+            {
+                pool.submit([&runs, i]()
+                            { runs[static_cast<size_t>(i)]++; });
+            }
+        }
+        {
+            WorkStealingPool idle(2); // 작업 없이 바로 소멸
+        }
+        bool shutdownOk = allOnce(runs);
+        std::cout << "Shutdown: " << (shutdownOk ? "OK" : "FAILED") << std::endl;
+        ok = ok && shutdownOk;
+    }
+
+    std::cout << "Work stealing pool: " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+// typing-report: SNOWMAN_ANALYTICS_DIR 에 쌓인 세션별 타자 로그(.snta)를 모아 요약하는 오프라인 도구
+//
+// 사용법:
+//   typing-report <파일.snta> ...
+//   typing-report $SNOWMAN_ANALYTICS_DIR/*.snta
+//
+// 결과: 세션별 WPM/정확도/백스페이스 비율 분포, 단어 지연 분포, 가장 많이 틀린 글자 (쳐야 했던 -> 실제로 친)
+// 파일 형식은 TypingAnalytics.h 참고
+//
+// 빌드 예:
+//   g++ -std=c++17 -O2 -o typing-report typing_report.cpp
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "TypingAnalytics.h"
+#include "Histogram.h"
+
+static void printDistribution(const char *name, const Histogram &h)
+{
+    std::cout << "  " << std::left << std::setw(12) << name << std::right
+              << " p10 " << std::setw(7) << h.percentile(10)
+              << "  p50 " << std::setw(7) << h.percentile(50)
+              << "  p90 " << std::setw(7) << h.percentile(90)
+              << "  p99 " << std::setw(7) << h.percentile(99)
+              << "  mean " << std::fixed << std::setprecision(1) << h.getMean() << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: typing-report <file.snta> ..." << std::endl;
+        return 1;
+    }
+
+    const int LETTERS = TypingAnalytics::LETTERS;
+    Histogram sessionWpm;         // 세션별 WPM
+    Histogram sessionAccuracy;    // 세션별 정확도 (%)
+    Histogram sessionBackspace;   // 세션별 백스페이스 비율 (천분율)
+    Histogram wordLatency;        // 모든 단어의 지연 (ms)
+    uint64_t letterErrors[LETTERS][LETTERS + 1] = {};
+    uint64_t letterCounts[LETTERS] = {};
+    uint64_t sessions = 0;
+    uint64_t keys = 0;
+    int failed = 0;
+
+    TypingAnalytics::Log log;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string error;
+        if (!TypingAnalytics::readLog(argv[i], log, error))
+        {
+            std::cerr << argv[i] << ": " << error << std::endl;
+            failed++;
+            continue;
+        }
+        sessions++;
+        keys += log.eventCodes.size();
+
+        uint64_t typed = 0;
+        uint64_t correct = 0;
+        uint64_t backspaces = 0;
+        for (size_t e = 0; e < log.eventCodes.size(); e++)
+        {
+            uint8_t code = log.eventCodes[e];
+            uint8_t flags = log.eventSlotFlags[e] >> 4;
+            if (code == TypingAnalytics::CODE_BACKSPACE)
+                backspaces++;
+            else if (code >= 32 && !(flags & TypingAnalytics::FLAG_UNCOUNTED))
+            {
+                typed++;
+                correct += (flags & TypingAnalytics::FLAG_HIT) ? 1 : 0;
+            }
+        }
+        double minutes = std::max(1000u, log.header.durationMillis) / 60000.0;
+        sessionWpm.record(static_cast<uint64_t>(correct / 5.0 / minutes + 0.5));
+        if (typed > 0)
+            sessionAccuracy.record(correct * 100 / typed);
+        if (!log.eventCodes.empty())
+            sessionBackspace.record(backspaces * 1000 / log.eventCodes.size());
+        for (uint32_t latency : log.wordLatencyMillis)
+            wordLatency.record(latency);
+        for (int expected = 0; expected < LETTERS; expected++)
+        {
+            letterCounts[expected] += log.letterCounts[expected];
+            for (int typedLetter = 0; typedLetter <= LETTERS; typedLetter++)
+                letterErrors[expected][typedLetter] += log.letterErrors[expected][typedLetter];
+        }
+    }
+
+    std::cout << "=== Typing Report ===" << std::endl;
+    std::cout << "  sessions " << sessions << ", keys " << keys;
+    if (failed > 0)
+        std::cout << " (" << failed << " unreadable)";
+    std::cout << std::endl;
+    if (sessions == 0)
+        return failed > 0 ? 1 : 0;
+
+    printDistribution("net wpm", sessionWpm);
+    printDistribution("accuracy%", sessionAccuracy);
+    printDistribution("bksp/1000", sessionBackspace);
+    printDistribution("word ms", wordLatency);
+
+    // 글자별 오류율이 높은 순서 (쳐야 했던 글자 기준) 와 가장 흔한 잘못 친 글자
+    struct LetterRow
+    {
+        int letter;
+        uint64_t errors;
+        uint64_t count;
+        int worstTyped;
+    };
+    std::vector<LetterRow> rows;
+    for (int expected = 0; expected < LETTERS; expected++)
+    {
+        LetterRow row = {expected, 0, letterCounts[expected], 0};
+        for (int typedLetter = 0; typedLetter <= LETTERS; typedLetter++)
+        {
+            row.errors += letterErrors[expected][typedLetter];
+            if (letterErrors[expected][typedLetter] > letterErrors[expected][row.worstTyped])
+                row.worstTyped = typedLetter;
+        }
+        if (row.errors > 0)
+            rows.push_back(row);
+    }
+    std::sort(rows.begin(), rows.end(), [](const LetterRow &a, const LetterRow &b)
+              { return a.errors * b.count > b.errors * a.count; });
+    std::cout << "  error letters (expected -> most typed instead):" << std::endl;
+    for (size_t i = 0; i < rows.size() && i < 5; i++)
+    {
+        const LetterRow &row = rows[i];
+        char worst = row.worstTyped < LETTERS ? static_cast<char>('a' + row.worstTyped) : '#';
+        std::cout << "    " << static_cast<char>('a' + row.letter) << " -> " << worst << "  "
+                  << std::setprecision(1) << (row.count ? row.errors * 100.0 / row.count : 0.0) << "% of "
+                  << row.count << std::endl;
+    }
+    return failed > 0 ? 1 : 0;
+}